@@ -0,0 +1,30 @@
+/** @file Arduino.h
+ *    This file stands in for the Arduino core when the filters are built on a
+ *    PC for benchmarking. Only the parts of the core which the filters use
+ *    are here: the integer types, the math functions, and the clock.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+
+/** @brief   Return the time since some moment in microseconds.
+ */
+inline uint32_t micros (void)
+{
+    struct timespec now;
+    clock_gettime (CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+}
+
+#endif // _HOST_ARDUINO_H_
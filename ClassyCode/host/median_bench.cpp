@@ -0,0 +1,164 @@
+/** @file median_bench.cpp
+ *    This file checks and times the running median filter on a PC. For each
+ *    window size from 5 to 101 samples, odd and even, the filter is run on
+ *    pseudo-random data, once with values which are nearly all different and
+ *    once with only a few values repeated over and over; every output is
+ *    compared with a median found by sorting the window, and then the time
+ *    per sample is measured. The Hampel filter is then checked by putting
+ *    spikes into a noisy signal and making sure each one, and nothing else,
+ *    is replaced by the median. To build and run it, from the @c ClassyCode
+ *    directory:
+ *    @code
+ *    g++ -O2 -I host -o median_bench host/median_bench.cpp
+ *    ./median_bench
+ *    @endcode
+ *    It returns 0 if every check passed and 1 if any failed.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include <algorithm>
+#include "../src/running_median.h"
+
+
+/// Number of samples which are checked against a sorted window
+const uint16_t CHECK_RUNS = 1000;
+
+/// Number of samples which are timed
+const uint32_t TIME_RUNS = 2000000;
+
+/// Type of a function which makes the test sample numbered @c run
+typedef float (*SampleFunction) (uint32_t run);
+
+
+/** @brief   Return a pseudo-random test sample, few of which are the same.
+ *  @param   run The sample's number
+ */
+static float sample (uint32_t run)
+{
+    return (float)((run * 7919U) % 1021U);
+}
+
+
+/** @brief   Return a pseudo-random test sample from only four values, so
+ *           that the window is full of equal samples.
+ *  @param   run The sample's number
+ */
+static float repeated_sample (uint32_t run)
+{
+    return (float)(((run * 2654435761U) >> 16) % 4U);
+}
+
+
+/** @brief   Check a median filter's output against sorting the window.
+ *  @tparam  WINDOW The size of the median filter's window
+ *  @param   p_sample The function which makes the test samples
+ *  @returns The number of wrong medians
+ */
+template <uint8_t WINDOW>
+uint16_t check_median (SampleFunction p_sample)
+{
+    RunningMedian<WINDOW> median;
+    float window[WINDOW];
+    uint16_t wrong = 0;
+    for (uint16_t run = 0; run < CHECK_RUNS; run++)
+    {
+        window[run % WINDOW] = p_sample (run);
+        uint8_t count = (run < WINDOW) ? run + 1 : WINDOW;
+        float sorted[WINDOW];
+        std::copy (window, window + count, sorted);
+        std::sort (sorted, sorted + count);
+        float expected = (count & 1) ? sorted[count / 2]
+                         : (sorted[count / 2 - 1] + sorted[count / 2]) / 2.0f;
+        if (median.run (p_sample (run)) != expected)
+        {
+            wrong++;
+        }
+    }
+    return wrong;
+}
+
+
+/** @brief   Check a median filter against sorting, then time it.
+ *  @tparam  WINDOW The size of the median filter's window
+ *  @returns The number of wrong medians
+ */
+template <uint8_t WINDOW>
+uint16_t check_and_time (void)
+{
+    uint16_t wrong = check_median<WINDOW> (sample);
+    uint16_t repeats_wrong = check_median<WINDOW> (repeated_sample);
+
+    RunningMedian<WINDOW> median;
+    float sum = 0.0;
+    uint32_t start = micros ();
+    for (uint32_t run = 0; run < TIME_RUNS; run++)
+    {
+        sum += median.run (sample (run));
+    }
+    uint32_t duration = micros () - start;
+
+    printf ("Median window %3u: %6.1f ns/sample, %u wrong, %u wrong with "
+            "repeats (%g)\n", WINDOW, duration * 1000.0 / TIME_RUNS, wrong,
+            repeats_wrong, sum);
+    return wrong + repeats_wrong;
+}
+
+
+/** @brief   Check that a Hampel filter replaces spikes and nothing else.
+ *  @details The signal is 100 with up to 0.5 of noise either way. Once the
+ *           window has filled, every 37th sample has 50 added to it or taken
+ *           from it; each of those must come out within the noise of 100,
+ *           every other sample must come out unchanged, and the filter must
+ *           count exactly the spikes as rejects.
+ *  @returns The number of samples which came out wrong, plus one if the
+ *           count of rejects is wrong
+ */
+static uint16_t check_hampel (void)
+{
+    HampelFilter<7> gate (3.0);
+    uint16_t wrong = 0;
+    uint32_t spikes = 0;
+    for (uint16_t run = 0; run < CHECK_RUNS; run++)
+    {
+        float input = 100.0f + (sample (run) - 510.0f) / 1020.0f;
+        bool spike = (run >= 20 && run % 37 == 0);
+        if (spike)
+        {
+            input += (spikes & 1) ? -50.0f : 50.0f;
+            spikes++;
+        }
+        float output = gate.run (input);
+        if (spike ? fabsf (output - 100.0f) > 0.5f : output != input)
+        {
+            wrong++;
+        }
+    }
+    if (gate.get_rejects () != spikes)
+    {
+        wrong++;
+    }
+    printf ("Hampel window 7: %lu spikes, %lu rejects, %u wrong\n",
+            (unsigned long)spikes, (unsigned long)gate.get_rejects (), wrong);
+    return wrong;
+}
+
+
+/** @brief   Check and time median filters of several sizes, then check the
+ *           Hampel filter.
+ *  @returns 0 if every check passed, 1 if not
+ */
+int main (void)
+{
+    uint16_t wrong = check_and_time<5> ()
+                     + check_and_time<10> ()
+                     + check_and_time<11> ()
+                     + check_and_time<21> ()
+                     + check_and_time<51> ()
+                     + check_and_time<64> ()
+                     + check_and_time<101> ()
+                     + check_hampel ();
+    return wrong ? 1 : 0;
+}
@@ -8,6 +8,7 @@
  *  @date  28 Sep 2020 Original file
  *  @date  9  Oct 2020 Added another task because I got bored
  *  @date  18 Oct 2020 Removed a task and repurposed as a class demonstration
+ *  @date  18 Oct 2026 Added spikes and a median-based outlier filter
  */
 
 #include <Arduino.h>
@@ -16,6 +17,7 @@
     #include <STM32FreeRTOS.h>
 #endif
 #include "first_order_IIR.h"
+#include "running_median.h"
 
 
 /** @brief   Task which tests a simple first-order filter class. 
@@ -42,17 +44,27 @@ void task_test_filter (void* p_params)
     // and runs every 0.1 seconds; the output begins at 0 units
     FirstOrderIIR my_filter (0.5, 0.1, 0.0);
 
+    // Put an outlier rejection filter in front of the first-order filter so
+    // that spikes are removed rather than smeared across many outputs
+    HampelFilter<7> spike_gate (3.0, 0.0);
+    float gated;                        // Input with spikes removed
+
     for (;;)
     {
         // Run the simulated filter, giving it a sine wave plus random junk
         the_time = millis ();
         noisy = sin ((the_time - start_time) / 2000.0)    // It's clean...
                 + (random (-1000, 1000) / 10000.0);       // now it's dirty
-        filtered = my_filter.run (noisy);
+        if (random (0, 20) == 0)
+        {
+            noisy += random (-50, 50) / 10.0;             // and spiky
+        }
+        gated = spike_gate.run (noisy);
+        filtered = my_filter.run (gated);
 
         // Print what we've found
-        Serial << (the_time / 1000.0) << "," << noisy << "," << filtered 
-               << endl;
+        Serial << (the_time / 1000.0) << "," << noisy << "," << gated << ","
+               << filtered << endl;
 
         // Timing accuracy isn't extremely important, so use the simpler delay
         vTaskDelay (100);
@@ -0,0 +1,386 @@
+/** @file running_median.h
+ *    This file contains a class template which implements a windowed running
+ *    median filter and an outlier-rejecting Hampel filter built on top of it.
+ *    A median filter removes single-sample spikes (such as those caused by
+ *    glitches on an I2C bus) completely, where a first-order IIR filter would
+ *    smear each spike across many outputs.
+ *
+ *    The median is kept by the "mediator" algorithm: a max-heap of the
+ *    smaller half of the window and a min-heap of the larger half are stored
+ *    back to back in one array, with the median at the junction. Each item in
+ *    the circular buffer of samples knows where it sits in the heaps, so the
+ *    oldest sample is overwritten in place and sifted to its new position in
+ *    O(log N) time. No memory is allocated after construction.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _RUNNING_MEDIAN_H_
+#define _RUNNING_MEDIAN_H_
+
+#include <Arduino.h>
+
+
+/** @brief   Class which implements a running median filter over a window of
+ *           the most recent @c WINDOW samples.
+ *  @details Until the window has filled, the median of the samples received so
+ *           far is returned. When an even number of samples is in the window,
+ *           the mean of the two middle samples is returned.
+ *  @tparam  WINDOW The number of samples over which the median is found; it
+ *           must be at least 1 and at most 255
+ */
+template <uint8_t WINDOW> class RunningMedian
+{
+protected:
+    /// Circular buffer holding the samples in the window
+    float data[WINDOW];
+
+    /// Position in the heaps of each item in the circular buffer
+    int16_t pos[WINDOW];
+
+    /// Storage for the heaps, which hold indices into the circular buffer
+    int16_t heap_buf[WINDOW];
+
+    /// Index in the circular buffer at which the next sample will be written
+    uint8_t index;
+
+    /// Number of samples which have been put into the window so far
+    uint8_t count;
+
+    /// The most recently computed median, which is saved between runs
+    float filter_output;
+
+    /** @brief   Get the heap slot at position @c i.
+     *  @details Position 0 holds the median; the max-heap grows to negative
+     *           positions and the min-heap to positive positions from there.
+     */
+    int16_t& heap (int16_t i)
+    {
+        return heap_buf[WINDOW / 2 + i];
+    }
+
+    /** @brief   Check if the item at heap position @c i is less than the item
+     *           at heap position @c j. */
+    bool less (int16_t i, int16_t j)
+    {
+        return data[heap (i)] < data[heap (j)];
+    }
+
+    /** @brief   Swap the items at heap positions @c i and @c j if the item at
+     *           @c i is less than the one at @c j.
+     *  @returns True if the items were swapped, false if not
+     */
+    bool compare_swap (int16_t i, int16_t j)
+    {
+        if (!less (i, j))
+        {
+            return false;
+        }
+        int16_t temp = heap (i);
+        heap (i) = heap (j);
+        heap (j) = temp;
+        pos[heap (i)] = i;
+        pos[heap (j)] = j;
+        return true;
+    }
+
+    /** @brief   Get the number of samples in the window.
+     *  @details This is @c count, which never passes @c WINDOW ; saying so
+     *           here lets the compiler see that the heap positions worked
+     *           out from it stay inside @c heap_buf[] .
+     */
+    uint8_t in_window (void) { return (count < WINDOW) ? count : WINDOW; }
+
+    /// Number of items in the min-heap, not counting the median
+    int16_t min_count (void) { return (in_window () - 1) / 2; }
+
+    /// Number of items in the max-heap, not counting the median
+    int16_t max_count (void) { return in_window () / 2; }
+
+    /** @brief   Move an item down the min-heap, starting with child @c i. */
+    void min_sort_down (int16_t i)
+    {
+        for ( ; i <= min_count (); i *= 2)
+        {
+            if (i > 1 && i < min_count () && less (i + 1, i))
+            {
+                i++;
+            }
+            if (!compare_swap (i, i / 2))
+            {
+                break;
+            }
+        }
+    }
+
+    /** @brief   Move an item down the max-heap, starting with child @c i. */
+    void max_sort_down (int16_t i)
+    {
+        for ( ; i >= -max_count (); i *= 2)
+        {
+            if (i < -1 && i > -max_count () && less (i, i - 1))
+            {
+                i--;
+            }
+            if (!compare_swap (i / 2, i))
+            {
+                break;
+            }
+        }
+    }
+
+    /** @brief   Move an item up the min-heap from position @c i.
+     *  @returns True if the item made it all the way up to the median slot
+     */
+    bool min_sort_up (int16_t i)
+    {
+        while (i > 0 && compare_swap (i, i / 2))
+        {
+            i /= 2;
+        }
+        return i == 0;
+    }
+
+    /** @brief   Move an item up the max-heap from position @c i.
+     *  @returns True if the item made it all the way up to the median slot
+     */
+    bool max_sort_up (int16_t i)
+    {
+        while (i < 0 && compare_swap (i / 2, i))
+        {
+            i /= 2;
+        }
+        return i == 0;
+    }
+
+public:
+    // Constructor which sets the initial value of the output
+    RunningMedian (float init_val = 0.0);
+
+    void reset (float init_val = 0.0);         // Empty the window
+    float run (float input);                   // Run one time step
+
+    /** @brief   Get the current median without running the filter.
+     *  @returns The median computed by the most recent call to @c run()
+     */
+    float get_output (void)
+    {
+        return filter_output;
+    }
+
+    /** @brief   Check whether a full window of samples has been received.
+     *  @returns True if the window is full, false if not
+     */
+    bool is_full (void)
+    {
+        return count == WINDOW;
+    }
+};
+
+
+/** @brief   Create a running median filter.
+ *  @param   init_val The value reported by @c get_output() until the filter
+ *           has been run for the first time
+ */
+template <uint8_t WINDOW>
+RunningMedian<WINDOW>::RunningMedian (float init_val)
+{
+    reset (init_val);
+}
+
+
+/** @brief   Empty the filter's window so it can start over.
+ *  @details The heaps are set up so that slot @c i of the circular buffer
+ *           alternates between the max-heap and min-heap sides, which keeps
+ *           both heaps valid while the window fills up.
+ *  @param   init_val The value reported by @c get_output() until the filter
+ *           has been run again
+ */
+template <uint8_t WINDOW>
+void RunningMedian<WINDOW>::reset (float init_val)
+{
+    for (int16_t i = WINDOW - 1; i >= 0; i--)
+    {
+        pos[i] = ((i + 1) / 2) * ((i & 1) ? -1 : 1);
+        heap (pos[i]) = i;
+        data[i] = init_val;
+    }
+    index = 0;
+    count = 0;
+    filter_output = init_val;
+}
+
+
+/** @brief   Put a new sample into the window and find the new median.
+ *  @details The oldest sample is replaced by the new one, which is then moved
+ *           up or down through the heaps until they are in order again.
+ *  @param   input The filter's input value, usually something measured
+ *  @returns The median of the samples in the window
+ */
+template <uint8_t WINDOW>
+float RunningMedian<WINDOW>::run (float input)
+{
+    bool filling = (count < WINDOW);
+    int16_t p = pos[index];
+    float old = data[index];
+
+    data[index] = input;
+    index = (index + 1 < WINDOW) ? index + 1 : 0;
+    if (filling)
+    {
+        count++;
+    }
+
+    if (p > 0)                                 // New item is in the min-heap
+    {
+        if (!filling && old < input)
+        {
+            min_sort_down (p * 2);
+        }
+        else if (min_sort_up (p))
+        {
+            max_sort_down (-1);
+        }
+    }
+    else if (p < 0)                            // New item is in the max-heap
+    {
+        if (!filling && input < old)
+        {
+            max_sort_down (p * 2);
+        }
+        else if (max_sort_up (p))
+        {
+            min_sort_down (1);
+        }
+    }
+    else                                       // New item is the median
+    {
+        if (max_count ())
+        {
+            max_sort_down (-1);
+        }
+        if (min_count ())
+        {
+            min_sort_down (1);
+        }
+    }
+
+    // With an even number of items, average the two in the middle
+    filter_output = data[heap (0)];
+    if ((count & 1) == 0)
+    {
+        filter_output = (filter_output + data[heap (-1)]) * 0.5;
+    }
+    return filter_output;
+}
+
+
+/** @brief   Class which implements a Hampel-style outlier rejection filter.
+ *  @details Each sample is compared with the running median of the window. If
+ *           it differs from the median by more than @c n_sigma times a robust
+ *           estimate of the standard deviation, it is replaced by the median;
+ *           otherwise it is passed through unchanged. The standard deviation
+ *           is estimated as 1.4826 times the median absolute deviation, which
+ *           is kept with a second running median of each sample's deviation
+ *           at the time it arrived; this keeps updates at O(log N) instead of
+ *           re-sorting the window for every sample.
+ *
+ *           The output of this filter may be given to a @c FirstOrderIIR so
+ *           that spikes are removed before the signal is smoothed:
+ *           @code
+ *           HampelFilter<7> gate (3.0);
+ *           FirstOrderIIR smoother (0.5, 0.1, 0.0);
+ *           ...
+ *           filtered = smoother.run (gate.run (measured));
+ *           @endcode
+ *  @tparam  WINDOW The number of samples used to find the median
+ */
+template <uint8_t WINDOW> class HampelFilter
+{
+protected:
+    /// Running median of the input samples
+    RunningMedian<WINDOW> values;
+
+    /// Running median of the samples' absolute deviations from the median
+    RunningMedian<WINDOW> deviations;
+
+    /// Number of robust standard deviations beyond which a sample is rejected
+    float n_sigma;
+
+    /// The value of the filter output, which is saved between runs
+    float filter_output;
+
+    /// The number of samples which have been rejected as outliers
+    uint32_t rejects;
+
+public:
+    // Constructor which is given the rejection threshold
+    HampelFilter (float threshold = 3.0, float init_val = 0.0);
+
+    float run (float input);                   // Run one time step
+
+    /** @brief   Get the current output of the filter without running it.
+     *  @returns The current value of the filter's output
+     */
+    float get_output (void)
+    {
+        return filter_output;
+    }
+
+    /** @brief   Get the number of samples which have been rejected so far.
+     *  @returns The number of outliers which were replaced by the median
+     */
+    uint32_t get_rejects (void)
+    {
+        return rejects;
+    }
+};
+
+
+/** @brief   Create a Hampel outlier rejection filter.
+ *  @param   threshold The number of robust standard deviations from the
+ *           median beyond which a sample is considered an outlier
+ *  @param   init_val The initial value of the filter output
+ */
+template <uint8_t WINDOW>
+HampelFilter<WINDOW>::HampelFilter (float threshold, float init_val)
+    : values (init_val), deviations (0.0)
+{
+    n_sigma = threshold;
+    filter_output = init_val;
+    rejects = 0;
+}
+
+
+/** @brief   Run the outlier rejection filter.
+ *  @details Until the window is full there isn't enough data to decide what
+ *           an outlier looks like, so samples are passed through unchanged.
+ *  @param   input The filter's input value, usually something measured
+ *  @returns The input, or the median of the window if the input is an outlier
+ */
+template <uint8_t WINDOW>
+float HampelFilter<WINDOW>::run (float input)
+{
+    float median = values.run (input);
+    float deviation = fabsf (input - median);
+
+    // Compare with the spread of the samples before this one was added
+    float limit = n_sigma * 1.4826 * deviations.get_output ();
+    bool ready = deviations.is_full ();
+    deviations.run (deviation);
+
+    if (ready && deviation > limit)
+    {
+        filter_output = median;
+        rejects++;
+    }
+    else
+    {
+        filter_output = input;
+    }
+    return filter_output;
+}
+
+#endif // _RUNNING_MEDIAN_H_
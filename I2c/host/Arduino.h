@@ -0,0 +1,151 @@
+/** @file Arduino.h
+ *    This file stands in for the Arduino core when the I2C drivers, the
+ *    simulated MMA8452Q and the tilt filters are built on a PC for testing.
+ *    Only the parts of the core which they use are here: @c Print and
+ *    @c Serial, the clocks, and a few math helpers.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+
+/// An 8-bit byte, as the Arduino core names it
+typedef uint8_t byte;
+
+#ifndef PI
+    #define PI 3.1415926535897932384626433832795
+#endif
+
+/// Keep a number between two limits
+#define constrain(amt, low, high) \
+    ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+
+/** @brief   Return the time since some moment in microseconds.
+ */
+inline uint32_t micros (void)
+{
+    struct timespec now;
+    clock_gettime (CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+}
+
+
+/** @brief   Return the time since some moment in milliseconds.
+ */
+inline uint32_t millis (void)
+{
+    struct timespec now;
+    clock_gettime (CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000ULL + now.tv_nsec / 1000000);
+}
+
+
+/** @brief   Wait for some milliseconds.
+ */
+inline void delay (uint32_t ms)
+{
+    struct timespec wait = { (time_t)(ms / 1000), (long)(ms % 1000) * 1000000L };
+    nanosleep (&wait, NULL);
+}
+
+
+/** @brief   A device to which text can be printed, as in the Arduino core.
+ */
+class Print
+{
+public:
+    /// Write one character; this is what descendents must provide
+    virtual size_t write (uint8_t character) = 0;
+
+    /// Write a block of characters one at a time
+    virtual size_t write (const uint8_t* p_data, size_t size)
+    {
+        size_t count = 0;
+        while (size--)
+        {
+            count += write (*p_data++);
+        }
+        return count;
+    }
+
+    /// Write a string
+    size_t write (const char* p_text)
+    {
+        return write ((const uint8_t*)p_text, strlen (p_text));
+    }
+
+    size_t print (const char* p_text) { return write (p_text); }
+    size_t print (char character) { return write ((uint8_t)character); }
+    size_t print (long number) { return print_format ("%ld", number); }
+    size_t print (int number) { return print ((long)number); }
+    size_t print (unsigned long number)
+    {
+        return print_format ("%lu", number);
+    }
+    size_t print (unsigned int number) { return print ((unsigned long)number); }
+    size_t print (unsigned char number)
+    {
+        return print ((unsigned long)number);
+    }
+    size_t print (double number, int digits = 2)
+    {
+        char text[32];
+        snprintf (text, sizeof (text), "%.*f", digits, number);
+        return write (text);
+    }
+
+    size_t println (const char* p_text) { return write (p_text) + write ("\n"); }
+
+    /// Print with a format, as the ESP32 and STM32 cores can
+    size_t printf (const char* format, ...)
+        __attribute__ ((format (printf, 2, 3)))
+    {
+        char text[128];
+        va_list args;
+        va_start (args, format);
+        vsnprintf (text, sizeof (text), format, args);
+        va_end (args);
+        return write (text);
+    }
+
+    virtual ~Print () { }
+
+protected:
+    /// Print one number with a @c printf() format
+    template <class Number> size_t print_format (const char* format,
+                                                 Number number)
+    {
+        char text[24];
+        snprintf (text, sizeof (text), format, number);
+        return write (text);
+    }
+};
+
+
+/** @brief   Standard output, which stands in for the serial port.
+ */
+class HostSerial : public Print
+{
+public:
+    size_t write (uint8_t character) { return putchar (character) != EOF; }
+    using Print::write;
+};
+
+/// The one standard output
+static HostSerial Serial;
+
+#endif // _HOST_ARDUINO_H_
@@ -0,0 +1,42 @@
+/** @file EEPROM.h
+ *    This file stands in for the Arduino EEPROM library on a PC. The EEPROM
+ *    is an array in memory which starts out erased each time a test runs.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _HOST_EEPROM_H_
+#define _HOST_EEPROM_H_
+
+#include "Arduino.h"
+
+
+/** @brief   EEPROM which is kept in memory.
+ */
+class HostEEPROM
+{
+public:
+    /// The EEPROM's bytes, all 0xFF when erased
+    uint8_t bytes[1024];
+
+    HostEEPROM (void) { memset (bytes, 0xFF, sizeof (bytes)); }
+
+    template <class Item> Item& get (int address, Item& item)
+    {
+        memcpy (&item, bytes + address, sizeof (Item));
+        return item;
+    }
+
+    template <class Item> const Item& put (int address, const Item& item)
+    {
+        memcpy (bytes + address, &item, sizeof (Item));
+        return item;
+    }
+};
+
+/// The one EEPROM
+static HostEEPROM EEPROM;
+
+#endif // _HOST_EEPROM_H_
@@ -0,0 +1,150 @@
+/** @file FreeRTOS.h
+ *    This file stands in for FreeRTOS when the I2C job engine is built on a
+ *    PC for testing. Queues are simple ring buffers
+ *    which never block: a full queue refuses an item at once, and an empty
+ *    one returns nothing, just as a real queue does with a wait time of 0.
+ *    There is only one thread, so critical sections do nothing.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _HOST_FREERTOS_H_
+#define _HOST_FREERTOS_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+#define portBASE_TYPE           long
+typedef void* TaskHandle_t;
+
+#define pdTRUE                  1
+#define pdFALSE                 0
+#define portMAX_DELAY           0xFFFFFFFF
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(ms))
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+
+/// A queue, which holds copies of its items in a ring buffer
+struct HostQueue
+{
+    uint8_t* p_items;                 ///< Storage for the items
+    size_t item_size;                 ///< Size of each item in bytes
+    UBaseType_t size;                 ///< Most items which fit
+    UBaseType_t count;                ///< Items in the queue now
+    UBaseType_t first;                ///< Index of the oldest item
+};
+
+typedef HostQueue* QueueHandle_t;
+
+
+inline QueueHandle_t xQueueCreate (UBaseType_t size, size_t item_size)
+{
+    QueueHandle_t queue = (QueueHandle_t)calloc (1, sizeof (HostQueue));
+    queue->p_items = (uint8_t*)calloc (size, item_size);
+    queue->item_size = item_size;
+    queue->size = size;
+    return queue;
+}
+
+inline BaseType_t xQueueSendToBack (QueueHandle_t queue, const void* p_item,
+                                    TickType_t)
+{
+    if (queue->count == queue->size)
+    {
+        return pdFALSE;
+    }
+    UBaseType_t slot = (queue->first + queue->count++) % queue->size;
+    memcpy (queue->p_items + slot * queue->item_size, p_item,
+            queue->item_size);
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueSendToFront (QueueHandle_t queue, const void* p_item,
+                                     TickType_t)
+{
+    if (queue->count == queue->size)
+    {
+        return pdFALSE;
+    }
+    queue->first = (queue->first + queue->size - 1) % queue->size;
+    queue->count++;
+    memcpy (queue->p_items + queue->first * queue->item_size, p_item,
+            queue->item_size);
+    return pdTRUE;
+}
+
+inline BaseType_t xQueuePeek (QueueHandle_t queue, void* p_item, TickType_t)
+{
+    if (queue->count == 0)
+    {
+        return pdFALSE;
+    }
+    memcpy (p_item, queue->p_items + queue->first * queue->item_size,
+            queue->item_size);
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive (QueueHandle_t queue, void* p_item,
+                                 TickType_t wait)
+{
+    if (!xQueuePeek (queue, p_item, wait))
+    {
+        return pdFALSE;
+    }
+    queue->first = (queue->first + 1) % queue->size;
+    queue->count--;
+    return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting (QueueHandle_t queue)
+{
+    return queue->count;
+}
+
+inline BaseType_t xQueueSendToBackFromISR (QueueHandle_t queue,
+                                           const void* p_item, BaseType_t*)
+{
+    return xQueueSendToBack (queue, p_item, 0);
+}
+
+inline BaseType_t xQueueSendToFrontFromISR (QueueHandle_t queue,
+                                            const void* p_item, BaseType_t*)
+{
+    return xQueueSendToFront (queue, p_item, 0);
+}
+
+inline BaseType_t xQueueReceiveFromISR (QueueHandle_t queue, void* p_item,
+                                        BaseType_t*)
+{
+    return xQueueReceive (queue, p_item, 0);
+}
+
+inline BaseType_t xQueuePeekFromISR (QueueHandle_t queue, void* p_item)
+{
+    return xQueuePeek (queue, p_item, 0);
+}
+
+inline UBaseType_t uxQueueMessagesWaitingFromISR (QueueHandle_t queue)
+{
+    return queue->count;
+}
+
+
+/// Number of task notifications given, as there are no real tasks to notify
+extern uint32_t host_notifications;
+
+inline BaseType_t xTaskNotifyGive (TaskHandle_t)
+{
+    host_notifications++;
+    return pdTRUE;
+}
+
+#endif // _HOST_FREERTOS_H_
@@ -0,0 +1,36 @@
+/** @file Wire.h
+ *    This file stands in for the Arduino Wire library on a PC, which has no
+ *    I2C bus. No device ever answers, so code which is to be tested on a PC
+ *    should reach its devices through an @c I2CPort such as @c MMA8452QSim.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _HOST_WIRE_H_
+#define _HOST_WIRE_H_
+
+#include "Arduino.h"
+
+
+/** @brief   An I2C bus on which nothing answers.
+ */
+class TwoWire
+{
+public:
+    void begin (void) { }
+    void setClock (uint32_t) { }
+    void beginTransmission (uint8_t) { }
+    size_t write (uint8_t) { return 1; }
+    size_t write (const uint8_t*, size_t length) { return length; }
+    uint8_t endTransmission (bool = true) { return 2; }   // Address NACK
+    uint8_t requestFrom (uint8_t, uint8_t) { return 0; }
+    int available (void) { return 0; }
+    int read (void) { return -1; }
+};
+
+/// The one I2C bus
+static TwoWire Wire;
+
+#endif // _HOST_WIRE_H_
@@ -0,0 +1,138 @@
+/** @file sim_bench.cpp
+ *    This file runs the simulated MMA8452Q and its bus benchmark on a PC, so
+ *    that the driver's ways of reading can be compared without a board and
+ *    without holding up the board's startup. A few checks are run first to
+ *    make sure the model behaves as the chip does, as the benchmark means
+ *    nothing if it doesn't. To build and run it, from the @c I2c directory:
+ *    @code
+ *    g++ -O2 -I host -o sim_bench host/sim_bench.cpp src/mma8452q_sim.cpp \
+ *        src/SparkFun_MMA8452Q.cpp src/i2c_port.cpp src/i2c_jobs.cpp \
+ *        src/baseshare.cpp
+ *    ./sim_bench
+ *    @endcode
+ *    It prints each check's result and the benchmark's table, and returns 0
+ *    if every check passed.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include <PrintStream.h>
+#include "../src/SparkFun_MMA8452Q.h"
+#include "../src/mma8452q_sim.h"
+
+
+/// The number of notifications given by @c xTaskNotifyGive()
+uint32_t host_notifications = 0;
+
+
+/** @brief   Make a waveform which is different on each axis and each sample.
+ *  @param   sample The sample number
+ *  @param   axis 0 for X, 1 for Y, or 2 for Z
+ *  @returns The acceleration in thousandths of a g
+ */
+static int16_t test_waveform (uint32_t sample, uint8_t axis)
+{
+    return (int16_t)((sample * 37 + axis * 500) % 3000) - 1500;
+}
+
+
+/** @brief   Check that the driver starts up on the model and that each frame
+ *           it reads holds the sample the model made.
+ *  @returns True if the check passed, false if not
+ */
+static bool check_frames (void)
+{
+    MMA8452QSim sim (0x1D, 400000);
+    sim.set_waveform (test_waveform);
+    MMA8452Q accel;
+    if (!accel.begin (sim, 0x1D))
+    {
+        printf ("FAIL frames: begin() didn't find the model\n");
+        return false;
+    }
+
+    uint16_t wrong = 0;
+    for (uint16_t count = 0; count < 100; count++)
+    {
+        sim.wait_for_data ();
+        uint32_t sample = sim.get_sample_count () - 1;
+        MMA8452Q_Frame frame;
+        if (!accel.readFrame (frame))
+        {
+            wrong++;
+            continue;
+        }
+        const short got[] = {frame.x, frame.y, frame.z};
+        for (uint8_t axis = 0; axis < 3; axis++)
+        {
+            // At 2 g full scale there are 1024 counts per g
+            int32_t expected = test_waveform (sample, axis) * 2048L / 2000L;
+            if (got[axis] != expected)
+            {
+                wrong++;
+            }
+        }
+    }
+    bool passed = (wrong == 0);
+    printf ("%s frames: %u wrong values\n", passed ? "pass" : "FAIL", wrong);
+    return passed;
+}
+
+
+/** @brief   Check that the model ignores changes to its settings while it's
+ *           active, as the chip does, and takes them in standby.
+ *  @returns True if the check passed, false if not
+ */
+static bool check_standby (void)
+{
+    MMA8452QSim sim (0x1D, 400000);
+    MMA8452Q accel;
+    accel.begin (sim, 0x1D);
+
+    uint8_t before = 0;
+    uint8_t after = 0;
+    uint8_t new_scale = SCALE_8G >> 2;           // Register bits for 8 g
+    sim.read_registers (0x1D, XYZ_DATA_CFG, &before, 1);
+    sim.write_registers (0x1D, XYZ_DATA_CFG, &new_scale, 1);
+    sim.read_registers (0x1D, XYZ_DATA_CFG, &after, 1);
+    bool passed = (after == before);
+
+    accel.setScale (SCALE_8G);                  // Goes to standby first
+    sim.read_registers (0x1D, XYZ_DATA_CFG, &after, 1);
+    passed &= ((after & 0x03) == new_scale);
+
+    printf ("%s standby: settings changed only in standby\n",
+            passed ? "pass" : "FAIL");
+    return passed;
+}
+
+
+/** @brief   Check that a device at another address doesn't answer.
+ *  @returns True if the check passed, false if not
+ */
+static bool check_address (void)
+{
+    MMA8452QSim sim (0x1D, 400000);
+    MMA8452Q accel;
+    bool passed = !accel.begin (sim, 0x1C);
+    printf ("%s address: %s at the wrong address\n", passed ? "pass" : "FAIL",
+            passed ? "nothing answered" : "something answered");
+    return passed;
+}
+
+
+/** @brief   Run the checks, then the benchmark.
+ *  @returns 0 if every check passed, 1 if any failed
+ */
+int main (void)
+{
+    bool passed = check_frames ();
+    passed &= check_standby ();
+    passed &= check_address ();
+    Serial << endl;
+
+    MMA8452Q_benchmark (Serial);
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,200 @@
+/** @file test_i2c_jobs.cpp
+ *    This file tests the I2C job engine on a PC, with a simulated MMA8452Q
+ *    in place of the bus. The driver and the engine share the model as
+ *    their @c I2CPort , as they share a @c TwoWirePort on the board, so
+ *    frames read through queued jobs can be checked against the samples the
+ *    model made, and the engine's bus utilization against the model's own
+ *    count of bus time. The bus task is stood in for by calling
+ *    @c run_one() without waiting. To build and run the tests, from the
+ *    @c I2c directory:
+ *    @code
+ *    g++ -O2 -I host -o test_i2c_jobs host/test_i2c_jobs.cpp \
+ *        src/i2c_jobs.cpp src/mma8452q_sim.cpp src/SparkFun_MMA8452Q.cpp \
+ *        src/i2c_port.cpp src/baseshare.cpp
+ *    ./test_i2c_jobs
+ *    @endcode
+ *    It prints each test's result and returns 0 if they all passed.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include <PrintStream.h>
+#include "../src/SparkFun_MMA8452Q.h"
+#include "../src/mma8452q_sim.h"
+#include "../src/i2c_jobs.h"
+
+
+/// The number of notifications given by @c xTaskNotifyGive()
+uint32_t host_notifications = 0;
+
+/// A stand-in for the handle of the task which waits for frames
+int waiting_task;
+
+/// The order in which callbacks were called, by each job's context
+uint8_t finished[4];
+
+/// The number of callbacks which have been called
+uint8_t finished_count = 0;
+
+
+/** @brief   Make a waveform which is different on each axis and each sample.
+ *  @param   sample The sample number
+ *  @param   axis 0 for X, 1 for Y, or 2 for Z
+ *  @returns The acceleration in thousandths of a g
+ */
+static int16_t test_waveform (uint32_t sample, uint8_t axis)
+{
+    return (int16_t)((sample * 53 + axis * 700) % 3000) - 1500;
+}
+
+
+/** @brief   Callback which writes down which job finished.
+ *  @param   job The finished job, whose context points to its number
+ */
+static void note_finished (I2CJob& job)
+{
+    if (finished_count < sizeof (finished))
+    {
+        finished[finished_count] = *(uint8_t*)job.p_context;
+    }
+    finished_count++;
+}
+
+
+/** @brief   Read frames through the engine as the sampling task does, and
+ *           check their values and the bus utilization.
+ *  @details At 800 Hz and 400 kHz, a 6-byte frame read holds the bus for
+ *           210 us of each 1250 us sample period, which is 16.8%.
+ *  @returns True if the test passed, false if not
+ */
+static bool check_frames (void)
+{
+    MMA8452QSim sim (0x1D, 400000);
+    sim.set_waveform (test_waveform);
+    MMA8452Q accel;
+    I2CJobEngine engine (sim);
+    if (!accel.begin (sim, 0x1D))
+    {
+        printf ("FAIL frames: begin() didn't find the model\n");
+        return false;
+    }
+
+    const uint16_t SAMPLES = 400;
+    uint16_t wrong = 0;
+    host_notifications = 0;
+    sim.reset_stats ();
+    engine.reset_stats ();
+    uint32_t start = sim.get_time_us ();
+    for (uint16_t count = 0; count < SAMPLES; count++)
+    {
+        sim.wait_for_data ();
+        uint32_t sample = sim.get_sample_count () - 1;
+        I2CJob job;
+        MMA8452Q_Frame frame;
+        if (!accel.readFrameAsync (engine, job, NULL, &waiting_task)
+            || !engine.run_one (0) || !job.done
+            || !accel.finishFrame (job, frame))
+        {
+            wrong++;
+            continue;
+        }
+        const short got[] = {frame.x, frame.y, frame.z};
+        for (uint8_t axis = 0; axis < 3; axis++)
+        {
+            // At 2 g full scale there are 1024 counts per g
+            if (got[axis] != test_waveform (sample, axis) * 2048L / 2000L)
+            {
+                wrong++;
+            }
+        }
+    }
+
+    float utilization = engine.get_utilization ();
+    float expected = (float)sim.get_bus_us () / (sim.get_time_us () - start);
+    bool passed = (wrong == 0 && engine.get_job_count () == SAMPLES
+                   && engine.get_fail_count () == 0
+                   && host_notifications == SAMPLES
+                   && fabsf (utilization - 0.168f) < 0.005f
+                   && fabsf (utilization - expected) < 0.005f);
+    printf ("%s frames: %u wrong values, %lu jobs, %lu notifications, "
+            "bus %.1f%% busy\n", passed ? "pass" : "FAIL", wrong,
+            (unsigned long)engine.get_job_count (),
+            (unsigned long)host_notifications, utilization * 100.0f);
+    return passed;
+}
+
+
+/** @brief   Check that jobs are run in the order they were queued, that a
+ *           full queue refuses jobs rather than waiting, and that a failed
+ *           transfer is counted and still reported as done.
+ *  @returns True if the test passed, false if not
+ */
+static bool check_queue (void)
+{
+    MMA8452QSim sim (0x1D, 400000);
+    I2CJobEngine engine (sim, 3);
+    I2CJob jobs[4];
+    uint8_t numbers[4] = {0, 1, 2, 3};
+    uint8_t data[4];
+
+    finished_count = 0;
+    for (uint8_t index = 0; index < 4; index++)
+    {
+        jobs[index].p_context = numbers + index;
+    }
+    bool queued = engine.read (jobs[0], 0x1D, WHO_AM_I, data, 1, note_finished)
+                  && engine.read (jobs[1], 0x1C, WHO_AM_I, data + 1, 1,
+                                  note_finished)
+                  && engine.read (jobs[2], 0x1D, CTRL_REG1, data + 2, 1,
+                                  note_finished);
+    bool refused = !engine.read (jobs[3], 0x1D, WHO_AM_I, data + 3, 1,
+                                 note_finished);
+    while (engine.run_one (0))
+    {
+    }
+
+    bool passed = (queued && refused && finished_count == 3
+                   && finished[0] == 0 && finished[1] == 1 && finished[2] == 2
+                   && jobs[0].done && jobs[0].ok && data[0] == 0x2A
+                   && jobs[1].done && !jobs[1].ok && jobs[2].ok
+                   && engine.get_job_count () == 3
+                   && engine.get_fail_count () == 1);
+    printf ("%s queue: jobs run in order, full queue refused, failure "
+            "counted\n", passed ? "pass" : "FAIL");
+    return passed;
+}
+
+
+/** @brief   Check that a driver won't queue reads on an engine which runs on
+ *           a port other than its own.
+ *  @returns True if the test passed, false if not
+ */
+static bool check_other_port (void)
+{
+    MMA8452QSim sim (0x1D, 400000);
+    MMA8452QSim other_sim (0x1D, 400000);
+    MMA8452Q accel;
+    I2CJobEngine engine (other_sim);
+    accel.begin (sim, 0x1D);
+
+    I2CJob job;
+    bool passed = !accel.readFrameAsync (engine, job)
+                  && !engine.run_one (0);
+    printf ("%s other port: %s\n", passed ? "pass" : "FAIL",
+            passed ? "read refused" : "read queued on the wrong bus");
+    return passed;
+}
+
+
+/** @brief   Run every test.
+ *  @returns 0 if every test passed, 1 if any failed
+ */
+int main (void)
+{
+    bool passed = check_frames ();
+    passed &= check_queue ();
+    passed &= check_other_port ();
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,251 @@
+/** @file test_tilt_fusion.cpp
+ *    This file tests the tilt filters on a PC by playing an accelerometer
+ *    trace through a simulated MMA8452Q, reading it with the driver at
+ *    800 Hz as the sampling task does, and feeding each reading to a
+ *    complementary filter and to an EKF. The trace is made the way one
+ *    recorded from a board would look: held at one tilt, shaken hard, then
+ *    set down at another tilt, with a few thousandths of a g of noise. The
+ *    angles and the EKF's covariance are checked against values worked out
+ *    from the filters' equations. To build and run the tests, from the
+ *    @c I2c directory:
+ *    @code
+ *    g++ -O2 -I host -o test_tilt_fusion host/test_tilt_fusion.cpp \
+ *        src/tilt_fusion.cpp src/mma8452q_sim.cpp src/SparkFun_MMA8452Q.cpp \
+ *        src/i2c_port.cpp src/i2c_jobs.cpp src/baseshare.cpp
+ *    ./test_tilt_fusion
+ *    @endcode
+ *    It prints each test's result and returns 0 if they all passed.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include <PrintStream.h>
+#include "../src/SparkFun_MMA8452Q.h"
+#include "../src/mma8452q_sim.h"
+#include "../src/tilt_fusion.h"
+
+
+/// The number of notifications given by @c xTaskNotifyGive()
+uint32_t host_notifications = 0;
+
+/// The time between samples at 800 Hz, in seconds
+const float DT = 0.00125f;
+
+/// The EKF's process noise, as given to its constructor
+const float EKF_Q = 0.001f;
+
+/// The EKF's measurement noise, as given to its constructor
+const float EKF_R = 0.03f;
+
+/// The number of degrees in a radian
+const float DEG = 180.0f / PI;
+
+
+/** @brief   A stretch of the trace during which the board is held still.
+ */
+struct TraceSegment
+{
+    float roll;                       ///< Roll angle in degrees
+    float pitch;                      ///< Pitch angle in degrees
+    float g;                          ///< Size of the acceleration in g
+    uint16_t samples;                 ///< Number of samples at 800 Hz
+};
+
+/// Held tilted, shaken hard along the same direction, then set down again
+const TraceSegment SEGMENTS[] =
+{
+    {20.0f, -10.0f, 1.0f, 600},
+    {20.0f, -10.0f, 2.0f, 80},
+    {-30.0f, 25.0f, 1.0f, 1200}
+};
+
+/// The number of samples in the whole trace
+const uint16_t TRACE_LENGTH = 600 + 80 + 1200;
+
+/// The trace in thousandths of a g, played by the simulated sensor
+int16_t trace[TRACE_LENGTH][3];
+
+
+/** @brief   Fill in the trace from its segments.
+ *  @details The acceleration is gravity in the sensor's axes,
+ *           [-sin(pitch), sin(roll) cos(pitch), cos(roll) cos(pitch)], times
+ *           the segment's size, plus up to 6 mg of noise on each axis from a
+ *           fixed pseudo-random sequence, so every run is the same.
+ */
+static void make_trace (void)
+{
+    uint32_t noise = 12345;
+    uint16_t index = 0;
+    for (uint8_t segment = 0; segment < 3; segment++)
+    {
+        float roll = SEGMENTS[segment].roll / DEG;
+        float pitch = SEGMENTS[segment].pitch / DEG;
+        float mg = SEGMENTS[segment].g * 1000.0f;
+        const float axes[3] = {-sinf (pitch), sinf (roll) * cosf (pitch),
+                               cosf (roll) * cosf (pitch)};
+        for (uint16_t count = 0; count < SEGMENTS[segment].samples; count++)
+        {
+            for (uint8_t axis = 0; axis < 3; axis++)
+            {
+                noise = noise * 1103515245UL + 12345UL;
+                int16_t jitter = (int16_t)((noise >> 16) % 13) - 6;
+                trace[index][axis] = (int16_t)lroundf (axes[axis] * mg)
+                                     + jitter;
+            }
+            index++;
+        }
+    }
+}
+
+
+/** @brief   Find the EKF's steady covariance of one angle with no gyro.
+ *  @details Each step adds @c q*dt to the variance and the measurement then
+ *           takes it to P R / (P + R), where R is the measurement noise
+ *           divided by how strongly gravity changes with that angle, which
+ *           is cos(pitch)^2 for roll and 1 for pitch. At the steady state
+ *           P^2 + q dt P - q dt R = 0.
+ *  @param   r The measurement noise for the angle
+ *  @returns The variance after a correction, in rad^2
+ */
+static float steady_variance (float r)
+{
+    float qdt = EKF_Q * DT;
+    return 0.5f * (-qdt + sqrtf (qdt * qdt + 4.0f * qdt * r));
+}
+
+
+/** @brief   Check that an angle is within a tolerance of what it should be.
+ *  @param   what The name of the angle, which is printed if it's wrong
+ *  @param   got The angle in radians
+ *  @param   expected The angle it should be in degrees
+ *  @param   tolerance How far off it may be in degrees
+ *  @returns True if the angle is close enough, false if not
+ */
+static bool check_angle (const char* what, float got, float expected,
+                         float tolerance)
+{
+    if (fabsf (got * DEG - expected) <= tolerance)
+    {
+        return true;
+    }
+    printf ("     %s is %.2f degrees, not %.2f\n", what, got * DEG, expected);
+    return false;
+}
+
+
+/** @brief   Play the trace through one filter and check it at the end of
+ *           each segment and partway through settling at the second tilt.
+ *  @param   mode Which filter to test
+ *  @returns True if the test passed, false if not
+ */
+static bool check_mode (TiltFusionMode mode)
+{
+    const char* name = (mode == FUSION_EKF) ? "EKF" : "complementary";
+    MMA8452QSim sim (0x1D, 400000);
+    sim.set_trace (trace, TRACE_LENGTH);
+    MMA8452Q accel;
+    if (!accel.begin (sim, 0x1D))
+    {
+        printf ("FAIL %s: begin() didn't find the model\n", name);
+        return false;
+    }
+    TiltFusion tilt (mode, 0.98f, EKF_Q, EKF_R);
+
+    // Start from the first sample after begin() rather than one made while
+    // it was setting the sensor up
+    sim.wait_for_data ();
+    accel.read ();
+    uint32_t first = sim.get_sample_count ();
+
+    bool passed = true;
+    float held_roll = 0.0f;
+    float held_pitch = 0.0f;
+    float held_cov[4];
+    float cov[4];
+    while (sim.get_sample_count () < TRACE_LENGTH)
+    {
+        sim.wait_for_data ();
+        uint32_t sample = sim.get_sample_count () - 1;
+        accel.read ();
+        tilt.update (accel, DT);
+
+        if (sample == 599)
+        {
+            // End of the first tilt
+            passed &= check_angle ("first roll", tilt.get_roll (), 20.0f,
+                                   0.5f);
+            passed &= check_angle ("first pitch", tilt.get_pitch (), -10.0f,
+                                   0.5f);
+            held_roll = tilt.get_roll ();
+            held_pitch = tilt.get_pitch ();
+            tilt.get_covariance (held_cov);
+        }
+        else if (sample == 679)
+        {
+            // End of the shaking, none of which should have been used; the
+            // EKF's variance grows by q dt each step while it coasts
+            tilt.get_covariance (cov);
+            float grown = (mode == FUSION_EKF) ? 80 * EKF_Q * DT : 0.0f;
+            if (tilt.get_roll () != held_roll
+                || tilt.get_pitch () != held_pitch
+                || fabsf (cov[0] - held_cov[0] - grown) > 1e-6f
+                || fabsf (cov[3] - held_cov[3] - grown) > 1e-6f)
+            {
+                printf ("     shaking changed the estimate\n");
+                passed = false;
+            }
+        }
+        else if (sample == 729 && mode == FUSION_COMPLEMENTARY)
+        {
+            // Each step closes 2% of the gap to the accelerometer angles
+            float left = powf (0.98f, 50.0f);
+            passed &= check_angle ("settling roll", tilt.get_roll (),
+                                   -30.0f + 50.0f * left, 0.5f);
+            passed &= check_angle ("settling pitch", tilt.get_pitch (),
+                                   25.0f - 35.0f * left, 0.5f);
+        }
+    }
+
+    passed &= check_angle ("last roll", tilt.get_roll (), -30.0f, 0.5f);
+    passed &= check_angle ("last pitch", tilt.get_pitch (), 25.0f, 0.5f);
+    tilt.get_covariance (cov);
+    if (mode == FUSION_EKF)
+    {
+        float cos_p = cosf (25.0f / DEG);
+        float roll_var = steady_variance (EKF_R / (cos_p * cos_p));
+        float pitch_var = steady_variance (EKF_R);
+        if (fabsf (cov[0] / roll_var - 1.0f) > 0.05f
+            || fabsf (cov[3] / pitch_var - 1.0f) > 0.05f
+            || fabsf (cov[1]) > 0.01f * pitch_var || cov[1] != cov[2])
+        {
+            printf ("     covariance is [%g %g; %g %g], not [%g 0; 0 %g]\n",
+                    cov[0], cov[1], cov[2], cov[3], roll_var, pitch_var);
+            passed = false;
+        }
+    }
+    else if (cov[0] != 0.1f || cov[1] != 0.0f || cov[3] != 0.1f)
+    {
+        printf ("     covariance changed without the EKF\n");
+        passed = false;
+    }
+
+    printf ("%s %s: %lu samples, roll %.2f, pitch %.2f degrees, variances "
+            "%.3g, %.3g\n", passed ? "pass" : "FAIL", name,
+            (unsigned long)(sim.get_sample_count () - first),
+            tilt.get_roll () * DEG, tilt.get_pitch () * DEG, cov[0], cov[3]);
+    return passed;
+}
+
+
+/** @brief   Run every test.
+ *  @returns 0 if every test passed, 1 if any failed
+ */
+int main (void)
+{
+    make_trace ();
+    bool passed = check_mode (FUSION_COMPLEMENTARY);
+    passed &= check_mode (FUSION_EKF);
+    return passed ? 0 : 1;
+}
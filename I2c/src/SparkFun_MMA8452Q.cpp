@@ -19,6 +19,23 @@ Distributed as-is; no warranty is given.
 #include "SparkFun_MMA8452Q.h"
 #include <Arduino.h>
 #include <Wire.h>
+#include <EEPROM.h>
+
+// The offsets as they are saved in EEPROM
+struct MMA8452Q_Calibration
+{
+	uint16_t magic; // MMA8452Q_CAL_MAGIC if offsets were saved
+	int8_t x, y, z; // OFF_X, OFF_Y and OFF_Z
+	uint8_t check;	// Checksum of magic and the offsets
+};
+
+#define MMA8452Q_CAL_MAGIC 0x0FF5
+
+// Checksum of a saved calibration, so that erased or stray EEPROM isn't used
+static uint8_t calibrationCheck(const MMA8452Q_Calibration &cal)
+{
+	return 0x5A ^ (cal.magic >> 8) ^ (cal.magic & 0xFF) ^ (uint8_t)cal.x ^ ((uint8_t)cal.y << 1 | (uint8_t)cal.y >> 7) ^ ((uint8_t)cal.z << 2 | (uint8_t)cal.z >> 6);
+}
 
 // CONSTRUCTUR
 //   This function, called when you initialize the class will simply write the
@@ -36,8 +53,19 @@ MMA8452Q::MMA8452Q(byte addr)
 // 	for backwards compatability purposes.
 bool MMA8452Q::begin(TwoWire &wirePort, uint8_t deviceAddress)
 {
-	_deviceAddress = deviceAddress;
 	_i2cPort = &wirePort;
+	_wirePort.attach(wirePort);
+
+	return begin(_wirePort, deviceAddress);
+}
+
+// BEGIN WITH ANY I2C PORT
+//	Works as begin() does, but talks to the sensor through an I2CPort, which
+//	may be a TwoWirePort or a simulated sensor such as MMA8452QSim.
+bool MMA8452Q::begin(I2CPort &port, uint8_t deviceAddress)
+{
+	_deviceAddress = deviceAddress;
+	_port = &port;
 
 	byte c = readRegister(WHO_AM_I); // Read WHO_AM_I register
 
@@ -46,15 +74,23 @@ bool MMA8452Q::begin(TwoWire &wirePort, uint8_t deviceAddress)
 		return false;
 	}
 
+	if (!loadShadow()) // Start from the sensor's present settings
+	{
+		return false;
+	}
+
 	scale = SCALE_2G;
 	odr = ODR_800;
 
+	beginConfig();	  // Collect the settings, then write them all at once
 	setScale(scale);  // Set up accelerometer scale
 	setDataRate(odr); // Set up output data rate
 	setupPL();		  // Set up portrait/landscape detection
 
 	// Multiply parameter by 0.0625g to calculate threshold.
 	setupTap(0x80, 0x80, 0x08); // Disable x, y, set z to 0.5g
+	loadCalibration();			// Restore saved offsets, if there are any
+	configure();
 
 	return true;
 }
@@ -72,6 +108,11 @@ byte MMA8452Q::init(MMA8452Q_Scale fsr, MMA8452Q_ODR odr)
 	{
 		_i2cPort = &Wire;
 	}
+	if (_port == NULL)
+	{
+		_wirePort.attach(*_i2cPort);
+		_port = &_wirePort;
+	}
 
 	_i2cPort->begin(); // Initialize I2C
 
@@ -82,15 +123,20 @@ byte MMA8452Q::init(MMA8452Q_Scale fsr, MMA8452Q_ODR odr)
 		return 0;
 	}
 
-	standby(); // Must be in standby to change registers
+	if (!loadShadow()) // Start from the sensor's present settings
+	{
+		return 0;
+	}
 
+	beginConfig();	  // Collect the settings, then write them all at once
 	setScale(scale);  // Set up accelerometer scale
 	setDataRate(odr); // Set up output data rate
 	setupPL();		  // Set up portrait/landscape detection
 	// Multiply parameter by 0.0625g to calculate threshold.
 	setupTap(0x80, 0x80, 0x08); // Disable x, y, set z to 0.5g
+	loadCalibration();			// Restore saved offsets, if there are any
 
-	active(); // Set to active to start reading
+	configure(); // Write the changes and set to active to start reading
 
 	return 1;
 }
@@ -101,28 +147,31 @@ byte MMA8452Q::readID()
 }
 
 // GET FUNCTIONS FOR RAW ACCELERATION DATA
+//	These are served from the most recent frame if it is younger than the
+//	frame max age, so calling getX(), getY() and getZ() in a row costs one
+//	6-byte burst instead of three separate transactions.
 // Returns raw X acceleration data
 short MMA8452Q::getX()
 {
-	byte rawData[2];
-	readRegisters(OUT_X_MSB, rawData, 2); // Read the X data into a data array
-	return ((short)(rawData[0] << 8 | rawData[1])) >> 4;
+	if (!frameIsFresh())
+		readFrame(_frame);
+	return _frame.x;
 }
 
 // Returns raw Y acceleration data
 short MMA8452Q::getY()
 {
-	byte rawData[2];
-	readRegisters(OUT_Y_MSB, rawData, 2); // Read the Y data into a data array
-	return ((short)(rawData[0] << 8 | rawData[1])) >> 4;
+	if (!frameIsFresh())
+		readFrame(_frame);
+	return _frame.y;
 }
 
 // Returns raw Z acceleration data
 short MMA8452Q::getZ()
 {
-	byte rawData[2];
-	readRegisters(OUT_Z_MSB, rawData, 2); // Read the Z data into a data array
-	return ((short)(rawData[0] << 8 | rawData[1])) >> 4;
+	if (!frameIsFresh())
+		readFrame(_frame);
+	return _frame.z;
 }
 
 // GET FUNCTIONS FOR CALCULATED ACCELERATION DATA
@@ -155,19 +204,165 @@ float MMA8452Q::getCalculatedZ()
 //		* floats cx, cy, and cz will store the calculated acceleration from
 //		  those 12-bit values. These variables are in units of g's.
 void MMA8452Q::read()
+{
+	readFrame(_frame);
+}
+
+// READ A FRAME
+//	Reads all three axes in one burst and stamps the result with micros().
+//	The burst is 6 bytes normally, or 3 in fast-read mode, in which case the
+//	8-bit values are shifted up so the frame is always in 12-bit counts.
+//	The frame is copied into "frame", cached for getX/Y/Z(), and x, y, z,
+//	cx, cy and cz are updated just as read() does. Returns false, leaving
+//	everything unchanged, if the sensor didn't send all the bytes.
+bool MMA8452Q::readFrame(MMA8452Q_Frame &frame)
 {
 	byte rawData[6]; // x/y/z accel register data stored here
 
-	readRegisters(OUT_X_MSB, rawData, 6); // Read the six raw data registers into data array
+	if (!readRegisters(OUT_X_MSB, rawData, _fastRead ? 3 : 6)) // F_READ skips the LSB registers
+		return false;
 
-	x = ((short)(rawData[0] << 8 | rawData[1])) >> 4;
-	y = ((short)(rawData[2] << 8 | rawData[3])) >> 4;
-	z = ((short)(rawData[4] << 8 | rawData[5])) >> 4;
+	decodeFrame(rawData);
+	frame = _frame;
+	return true;
+}
+
+// READ A FRAME WITHOUT WAITING
+//	Queues a read of the data registers on a job engine and returns at once.
+//	When the job is done, the bus task calls "callback" and/or notifies the
+//	"notify" task; then finishFrame() turns the data into a frame. The job's
+//	p_context is left as the caller set it, for the callback's use. Only one
+//	of these reads may be in progress at a time, and the blocking functions
+//	must not be used while one is. The engine must run on the same I2CPort
+//	which was given to begin(), so that blocking and queued transfers reach
+//	the same sensor. Returns false if it doesn't or the job queue was full.
+bool MMA8452Q::readFrameAsync(I2CJobEngine &engine, I2CJob &job, I2CJobCallback callback, TaskHandle_t notify)
+{
+	if (&engine.get_port() != _port)
+		return false;
+
+	return engine.read(job, _deviceAddress, OUT_X_MSB, _asyncData, _fastRead ? 3 : 6, callback, notify);
+}
+
+// FINISH AN ASYNCHRONOUS FRAME READ
+//	Turns the data from a finished readFrameAsync() job into a frame, just as
+//	readFrame() does, stamped with the time this is called. Returns false if
+//	the transfer failed.
+bool MMA8452Q::finishFrame(const I2CJob &job, MMA8452Q_Frame &frame)
+{
+	if (!job.ok)
+		return false;
+
+	decodeFrame(job.p_data);
+	frame = _frame;
+	return true;
+}
+
+// DECODE A FRAME
+//	Turns raw data register bytes into the cached frame and updates x, y, z,
+//	cx, cy and cz. In fast-read mode there are 3 bytes, whose 8-bit values
+//	are shifted up so the frame is always in 12-bit counts.
+void MMA8452Q::decodeFrame(const byte *rawData)
+{
+	if (_fastRead)
+	{
+		_frame.x = (short)(int8_t)rawData[0] * 16;
+		_frame.y = (short)(int8_t)rawData[1] * 16;
+		_frame.z = (short)(int8_t)rawData[2] * 16;
+	}
+	else
+	{
+		_frame.x = ((short)(rawData[0] << 8 | rawData[1])) >> 4;
+		_frame.y = ((short)(rawData[2] << 8 | rawData[3])) >> 4;
+		_frame.z = ((short)(rawData[4] << 8 | rawData[5])) >> 4;
+	}
+	_frame.time = micros();
+	_frameValid = true;
+
+	x = _frame.x;
+	y = _frame.y;
+	z = _frame.z;
 	cx = (float)x / (float)(1 << 11) * (float)(scale);
 	cy = (float)y / (float)(1 << 11) * (float)(scale);
 	cz = (float)z / (float)(1 << 11) * (float)(scale);
 }
 
+// READ AN 8-BIT FRAME
+//	Reads the most significant byte of each axis. In fast-read mode this is a
+//	3-byte burst; otherwise all 6 bytes are read and the LSBs are dropped.
+//	One count is scale / 128 g. The cached frame and x, y, z, cx, cy and cz
+//	are updated as by readFrame().
+bool MMA8452Q::readFrame8(MMA8452Q_Frame8 &frame)
+{
+	MMA8452Q_Frame full;
+
+	if (!readFrame(full))
+		return false;
+
+	frame.time = full.time;
+	frame.x = (int8_t)(full.x >> 4);
+	frame.y = (int8_t)(full.y >> 4);
+	frame.z = (int8_t)(full.z >> 4);
+	return true;
+}
+
+// SET FAST-READ MODE
+//	Turns the F_READ bit in CTRL_REG1 on or off. In fast-read mode the
+//	sensor's address pointer skips the LSB registers, so a sample is a
+//	3-byte burst instead of 6 and only 8 bits of each axis are kept.
+void MMA8452Q::setFastRead(bool enable)
+{
+	stageBits(CTRL_REG1, 0x02, enable ? 0x02 : 0x00); // F_READ
+	if (!_batching)
+		configure();
+}
+
+// CHECK FAST-READ MODE
+//	Returns true if the sensor is set to fast-read (8-bit) mode
+bool MMA8452Q::isFastRead()
+{
+	return _fastRead;
+}
+
+// FRAME BUS TIME
+//	Returns how many microseconds one frame read holds the bus at a clock of
+//	"clockHz", counting 9 bits per byte plus start, repeated start and stop:
+//	address+W, register, address+R, then 6 data bytes (3 in fast-read mode).
+//	Compare with the sample period at each ODR to see how much of the bus a
+//	sensor uses, e.g. at 100 kHz and ODR_800 it is 67% in 12-bit mode and
+//	46% in 8-bit mode.
+uint32_t MMA8452Q::frameBusTime(uint32_t clockHz, bool fastRead)
+{
+	uint32_t bits = 3 * 9 + (fastRead ? 3 : 6) * 9 + 3;
+	return (bits * 1000000UL + clockHz - 1) / clockHz;
+}
+
+// GET THE CACHED FRAME
+//	Returns the most recent frame, reading a new one first if the cached
+//	frame is older than the frame max age.
+const MMA8452Q_Frame &MMA8452Q::getFrame()
+{
+	if (!frameIsFresh())
+		readFrame(_frame);
+	return _frame;
+}
+
+// SET THE FRAME MAX AGE
+//	Sets how long, in microseconds, getX/Y/Z() and getFrame() may return a
+//	cached frame before a new burst is read. setDataRate() sets this to one
+//	sample period; 0 makes every call read the sensor.
+void MMA8452Q::setFrameMaxAge(uint32_t maxAgeUs)
+{
+	_frameMaxAge = maxAgeUs;
+}
+
+// CHECK THE CACHED FRAME
+//	Returns true if a frame has been read and is younger than the max age.
+bool MMA8452Q::frameIsFresh()
+{
+	return _frameValid && (micros() - _frame.time) < _frameMaxAge;
+}
+
 // CHECK IF NEW DATA IS AVAILABLE
 //	This function checks the status of the MMA8452Q to see if new data is availble.
 //	returns 0 if no new data is present, or a 1 if new data is available.
@@ -181,19 +376,10 @@ byte MMA8452Q::available()
 //	Possible values for the fsr variable are SCALE_2G, SCALE_4G, or SCALE_8G.
 void MMA8452Q::setScale(MMA8452Q_Scale fsr)
 {
-	// Must be in standby mode to make changes!!!
-	// Change to standby if currently in active state
-	if (isActive() == true)
-		standby();
-
-	byte cfg = readRegister(XYZ_DATA_CFG);
-	cfg &= 0xFC;	   // Mask out scale bits
-	cfg |= (fsr >> 2); // Neat trick, see page 22. 00 = 2G, 01 = 4A, 10 = 8G
-	writeRegister(XYZ_DATA_CFG, cfg);
-
-	// Return to active state when done
-	// Must be in active state to read data
-	active();
+	scale = fsr;
+	stageBits(XYZ_DATA_CFG, 0x03, fsr >> 2); // Neat trick, see page 22. 00 = 2G, 01 = 4A, 10 = 8G
+	if (!_batching)
+		configure();
 }
 
 // SET THE OUTPUT DATA RATE
@@ -202,19 +388,128 @@ void MMA8452Q::setScale(MMA8452Q_Scale fsr)
 //	ODR_100, ODR_50, ODR_12, ODR_6, or ODR_1
 void MMA8452Q::setDataRate(MMA8452Q_ODR odr)
 {
-	// Must be in standby mode to make changes!!!
-	// Change to standby if currently in active state
-	if (isActive() == true)
-		standby();
+	this->odr = odr;
+	stageBits(CTRL_REG1, 0x38, odr << 3); // Data rate bits
 
-	byte ctrl = readRegister(CTRL_REG1);
-	ctrl &= 0xC7; // Mask out data rate bits
-	ctrl |= (odr << 3);
-	writeRegister(CTRL_REG1, ctrl);
+	// Cached frames are good for one sample period (us) at the new rate
+	static const uint32_t odrPeriodUs[] = {1250, 2500, 5000, 10000,
+										   20000, 80000, 160000, 640000};
+	_frameMaxAge = odrPeriodUs[odr];
 
-	// Return to active state when done
-	// Must be in active state to read data
-	active();
+	if (!_batching)
+		configure();
+}
+
+// ENABLE DATA-READY INTERRUPT
+//	Routes the data-ready (DRDY) signal to INT1 (or INT2 if useInt1 is
+//	false) through CTRL_REG4 and CTRL_REG5. The pin is active low and
+//	push-pull, and stays asserted until the data registers are read, so
+//	attach a FALLING interrupt to it and read one frame per interrupt. That
+//	replaces polling available(), which costs a STATUS read every time.
+void MMA8452Q::enableDataReadyInt(bool useInt1)
+{
+	enableEventInt(INT_DRDY, useInt1);
+}
+
+// DISABLE DATA-READY INTERRUPT
+//	Stops the DRDY signal from driving an interrupt pin.
+void MMA8452Q::disableDataReadyInt()
+{
+	disableEventInt(INT_DRDY);
+}
+
+// SET UP MOTION/FREEFALL DETECTION
+//	Sets up the freefall/motion engine on the chosen axes (AXIS_X, AXIS_Y,
+//	AXIS_Z or AXES_XYZ). In motion mode an event happens when any chosen axis
+//	goes above the threshold; in freefall mode, when all of them are below it.
+//	Gravity is included, so for motion the threshold must be above 1g on an
+//	axis which points up. The threshold is in steps of 0.063g (0 - 127) and
+//	count is the number of samples the condition must last. The event is
+//	latched until readMotion() is called.
+void MMA8452Q::setupMotion(byte threshold, byte count, bool freefall, byte axes)
+{
+	// ELE (latch), OAE (1 = motion, 0 = freefall) and XEFE, YEFE, ZEFE
+	stageRegister(FF_MT_CFG, 0x80 | (freefall ? 0x00 : 0x40) | ((axes & AXES_XYZ) << 3));
+	stageRegister(FF_MT_THS, threshold & 0x7F); // DBCNTM = 0: count down when below
+	stageRegister(FF_MT_COUNT, count);
+	if (!_batching)
+		configure();
+}
+
+// SET UP TRANSIENT DETECTION
+//	Sets up the transient engine, which looks for a change in acceleration on
+//	the chosen axes. With highPass true, gravity is taken out by the chip's
+//	high-pass filter (see HP_FILTER_CUTOFF), so any jolt over the threshold
+//	counts no matter how the board is tilted; this is usually the best way
+//	to tell that something has started to move. The threshold is in steps
+//	of 0.063g (0 - 127) and count is the number of samples it must last.
+//	The event is latched until readTransient() is called.
+void MMA8452Q::setupTransient(byte threshold, byte count, byte axes, bool highPass)
+{
+	// ELE (latch), XTEFE, YTEFE, ZTEFE and HPF_BYP
+	stageRegister(TRANSIENT_CFG, 0x10 | ((axes & AXES_XYZ) << 1) | (highPass ? 0x00 : 0x01));
+	stageRegister(TRANSIENT_THS, threshold & 0x7F);
+	stageRegister(TRANSIENT_COUNT, count);
+	if (!_batching)
+		configure();
+}
+
+// ENABLE EVENT INTERRUPTS
+//	Routes one or more interrupt sources (INT_DRDY, INT_FF_MT, INT_PULSE,
+//	INT_LNDPRT, INT_TRANS, INT_ASLP) to INT1, or to INT2 if useInt1 is
+//	false. Sources already routed elsewhere stay where they are, so data
+//	ready can go to one pin and motion events to the other. A task which
+//	waits on the event pin needs no bus traffic at all until something
+//	happens; it then reads INT_SOURCE, or the engine's own source register
+//	(readMotion(), readTransient(), readTap() or readPL()) to clear it.
+void MMA8452Q::enableEventInt(byte sources, bool useInt1)
+{
+	stageBits(CTRL_REG5, sources, useInt1 ? sources : 0x00); // 1 = INT1, 0 = INT2
+	stageBits(CTRL_REG4, sources, sources);					 // Enable each source
+	if (!_batching)
+		configure();
+}
+
+// DISABLE EVENT INTERRUPTS
+//	Stops one or more interrupt sources from driving an interrupt pin.
+void MMA8452Q::disableEventInt(byte sources)
+{
+	stageBits(CTRL_REG4, sources, 0x00);
+	if (!_batching)
+		configure();
+}
+
+// READ INTERRUPT SOURCE
+//	Returns INT_SOURCE, whose bits (INT_DRDY, INT_FF_MT, ...) show which
+//	events are asserting an interrupt. Reading it clears nothing.
+byte MMA8452Q::readInterruptSource()
+{
+	return readRegister(INT_SOURCE);
+}
+
+// READ MOTION STATUS
+//	Returns the lower 7 bits of FF_MT_SRC if a motion or freefall event has
+//	happened, or 0 if not. Reading the register clears the event.
+byte MMA8452Q::readMotion()
+{
+	byte motionStat = readRegister(FF_MT_SRC);
+	if (motionStat & 0x80) // EA bit shows an event happened
+		return motionStat & 0x7F;
+	else
+		return 0;
+}
+
+// READ TRANSIENT STATUS
+//	Returns the lower 6 bits of TRANSIENT_SRC, which show the axes and
+//	directions of a transient event, or 0 if none has happened. Reading
+//	the register clears the event.
+byte MMA8452Q::readTransient()
+{
+	byte transStat = readRegister(TRANSIENT_SRC);
+	if (transStat & 0x40) // EA bit shows an event happened
+		return transStat & 0x3F;
+	else
+		return 0;
 }
 
 // SET UP TAP DETECTION
@@ -226,11 +521,6 @@ void MMA8452Q::setDataRate(MMA8452Q_ODR odr)
 //			on that axis.
 void MMA8452Q::setupTap(byte xThs, byte yThs, byte zThs)
 {
-	// Must be in standby mode to make changes!!!
-	// Change to standby if currently in active state
-	if (isActive() == true)
-		standby();
-
 	// Set up single and double tap - 5 steps:
 	// for more info check out this app note:
 	// http://cache.freescale.com/files/sensors/doc/app_note/AN4072.pdf
@@ -239,31 +529,29 @@ void MMA8452Q::setupTap(byte xThs, byte yThs, byte zThs)
 	if (!(xThs & 0x80)) // If top bit ISN'T set
 	{
 		temp |= 0x3;					 // Enable taps on x
-		writeRegister(PULSE_THSX, xThs); // x thresh
+		stageRegister(PULSE_THSX, xThs); // x thresh
 	}
 	if (!(yThs & 0x80))
 	{
 		temp |= 0xC;					 // Enable taps on y
-		writeRegister(PULSE_THSY, yThs); // y thresh
+		stageRegister(PULSE_THSY, yThs); // y thresh
 	}
 	if (!(zThs & 0x80))
 	{
 		temp |= 0x30;					 // Enable taps on z
-		writeRegister(PULSE_THSZ, zThs); // z thresh
+		stageRegister(PULSE_THSZ, zThs); // z thresh
 	}
 	// Set up single and/or double tap detection on each axis individually.
-	writeRegister(PULSE_CFG, temp | 0x40);
+	stageRegister(PULSE_CFG, temp | 0x40);
 	// Set the time limit - the maximum time that a tap can be above the thresh
-	writeRegister(PULSE_TMLT, 0x30); // 30ms time limit at 800Hz odr
+	stageRegister(PULSE_TMLT, 0x30); // 30ms time limit at 800Hz odr
 	// Set the pulse latency - the minimum required time between pulses
-	writeRegister(PULSE_LTCY, 0xA0); // 200ms (at 800Hz odr) between taps min
+	stageRegister(PULSE_LTCY, 0xA0); // 200ms (at 800Hz odr) between taps min
 	// Set the second pulse window - maximum allowed time between end of
 	//	latency and start of second pulse
-	writeRegister(PULSE_WIND, 0xFF); // 5. 318ms (max value) between taps max
-
-	// Return to active state when done
-	// Must be in active state to read data
-	active();
+	stageRegister(PULSE_WIND, 0xFF); // 5. 318ms (max value) between taps max
+	if (!_batching)
+		configure();
 }
 
 // READ TAP STATUS
@@ -285,21 +573,14 @@ byte MMA8452Q::readTap()
 //	This function sets up portrait and landscape detection.
 void MMA8452Q::setupPL()
 {
-	// Must be in standby mode to make changes!!!
-	// Change to standby if currently in active state
-	if (isActive() == true)
-		standby();
-
 	// For more info check out this app note:
 	//	http://cache.freescale.com/files/sensors/doc/app_note/AN4068.pdf
 	// 1. Enable P/L
-	writeRegister(PL_CFG, readRegister(PL_CFG) | 0x40); // Set PL_EN (enable)
+	stageBits(PL_CFG, 0x40, 0x40); // Set PL_EN (enable)
 	// 2. Set the debounce rate
-	writeRegister(PL_COUNT, 0x50); // Debounce counter at 100ms (at 800 hz)
-
-	// Return to active state when done
-	// Must be in active state to read data
-	active();
+	stageRegister(PL_COUNT, 0x50); // Debounce counter at 100ms (at 800 hz)
+	if (!_batching)
+		configure();
 }
 
 // READ PORTRAIT/LANDSCAPE STATUS
@@ -316,6 +597,141 @@ byte MMA8452Q::readPL()
 		return (plStat & 0x6) >> 1;
 }
 
+// SET OFFSETS
+//	Writes the sensor's offset registers, which it adds to every sample
+//	before the data is read. One step is 2mg at any scale, from -256mg
+//	(-128) to +254mg (127).
+void MMA8452Q::setOffsets(int8_t xOff, int8_t yOff, int8_t zOff)
+{
+	stageRegister(OFF_X, (byte)xOff);
+	stageRegister(OFF_Y, (byte)yOff);
+	stageRegister(OFF_Z, (byte)zOff);
+	if (!_batching)
+		configure();
+}
+
+// GET OFFSETS
+//	Gets the offsets last written to the sensor, from the shadow registers.
+void MMA8452Q::getOffsets(int8_t &xOff, int8_t &yOff, int8_t &zOff)
+{
+	xOff = (int8_t)shadow(OFF_X);
+	yOff = (int8_t)shadow(OFF_Y);
+	zOff = (int8_t)shadow(OFF_Z);
+}
+
+// CALIBRATE OFFSETS
+//	Finds offsets which take the bias out of each axis and writes them to
+//	the sensor, so that readings need no correction afterwards. The sensor
+//	must be held still with "upAxis" (AXIS_X, AXIS_Y or AXIS_Z) pointing up,
+//	or down if upsideDown is true; that axis should then read 1g and the
+//	others 0g. The offsets are cleared, a few samples are thrown away, and
+//	then "samples" samples are averaged. If a calibration address has been
+//	set, the offsets are saved there and restored by begin() and init().
+//	Returns false, leaving the offsets cleared, if the sensor stops sending
+//	data.
+bool MMA8452Q::calibrate(uint16_t samples, byte upAxis, bool upsideDown)
+{
+	if (samples == 0)
+		return false;
+
+	setOffsets(0, 0, 0);
+
+	int32_t sum[3] = {0, 0, 0};
+	for (uint16_t n = 0; n < samples + 4; n++)
+	{
+		// Wait for each new sample; at the slowest ODR that takes 640 ms
+		uint32_t start = millis();
+		while (!available())
+		{
+			if (millis() - start > 1000)
+				return false;
+		}
+		MMA8452Q_Frame frame;
+		if (!readFrame(frame))
+			return false;
+		if (n >= 4) // The first samples may be from before the offsets changed
+		{
+			sum[0] += frame.x;
+			sum[1] += frame.y;
+			sum[2] += frame.z;
+		}
+	}
+
+	// Take 1g off the axis which points up
+	int32_t oneG = (int32_t)samples * 2048 / scale;
+	for (byte axis = 0; axis < 3; axis++)
+	{
+		if (upAxis == (AXIS_X << axis))
+			sum[axis] -= upsideDown ? -oneG : oneG;
+	}
+
+	// One offset step is 2mg, which is 4 / scale counts, so counts are turned
+	// into steps by multiplying by scale / 4
+	int8_t offset[3];
+	for (byte axis = 0; axis < 3; axis++)
+	{
+		int32_t steps = -sum[axis] * (int32_t)scale;
+		int32_t divisor = 4 * (int32_t)samples;
+		steps = (steps + (steps < 0 ? -divisor / 2 : divisor / 2)) / divisor; // Rounded
+		offset[axis] = (int8_t)constrain(steps, -128, 127);
+	}
+	setOffsets(offset[0], offset[1], offset[2]);
+
+	_calibrated = true;
+	saveCalibration();
+	return true;
+}
+
+// SET CALIBRATION ADDRESS
+//	Sets where in EEPROM calibrate() saves the offsets and begin() and init()
+//	look for them. Call this before begin(); -1, the default, means the
+//	offsets aren't saved. The record takes 6 bytes.
+void MMA8452Q::setCalibrationAddress(int eepromAddress)
+{
+	_calAddress = eepromAddress;
+}
+
+// CHECK CALIBRATION
+//	Returns true if offsets were restored from EEPROM or found by calibrate()
+bool MMA8452Q::isCalibrated()
+{
+	return _calibrated;
+}
+
+// LOAD CALIBRATION
+//	Stages the offsets saved in EEPROM, if a calibration address has been set
+//	and a good record is there. Returns true if offsets were found.
+bool MMA8452Q::loadCalibration()
+{
+	if (_calAddress < 0)
+		return false;
+
+	MMA8452Q_Calibration cal;
+	EEPROM.get(_calAddress, cal);
+	if (cal.magic != MMA8452Q_CAL_MAGIC || cal.check != calibrationCheck(cal))
+		return false;
+
+	stageRegister(OFF_X, (byte)cal.x);
+	stageRegister(OFF_Y, (byte)cal.y);
+	stageRegister(OFF_Z, (byte)cal.z);
+	_calibrated = true;
+	return true;
+}
+
+// SAVE CALIBRATION
+//	Saves the present offsets in EEPROM, if a calibration address has been set.
+void MMA8452Q::saveCalibration()
+{
+	if (_calAddress < 0)
+		return;
+
+	MMA8452Q_Calibration cal;
+	cal.magic = MMA8452Q_CAL_MAGIC;
+	getOffsets(cal.x, cal.y, cal.z);
+	cal.check = calibrationCheck(cal);
+	EEPROM.put(_calAddress, cal);
+}
+
 // CHECK FOR ORIENTATION
 bool MMA8452Q::isRight()
 {
@@ -352,20 +768,114 @@ bool MMA8452Q::isFlat()
 	return false;
 }
 
+// BEGIN A BATCH OF SETTINGS
+//	After this is called, setScale(), setDataRate(), setFastRead(), setupPL(),
+//	setupTap(), setupMotion(), setupTransient() and the interrupt setup
+//	functions only change the shadow registers. Nothing is sent to the
+//	sensor until configure() is called.
+void MMA8452Q::beginConfig()
+{
+	_batching = true;
+}
+
+// WRITE CHANGED SETTINGS
+//	Writes every shadow register that differs from the sensor inside one
+//	standby/active bracket. Changed registers at consecutive addresses go
+//	in one burst, and nothing is read back, so changing the data rate costs
+//	two writes instead of about eight transactions. Does nothing if no
+//	setting has changed.
+void MMA8452Q::configure()
+{
+	_batching = false;
+	if (_dirty == 0)
+		return;
+
+	standby(); // Must be in standby mode to make changes!!!
+
+	// CTRL_REG1 is written last, by active(), so leave it out of the bursts
+	uint64_t dirty = _dirty & ~(1ULL << (CTRL_REG1 - XYZ_DATA_CFG));
+	byte first = 0;
+	while (dirty)
+	{
+		while (!((dirty >> first) & 1))
+			first++;
+		byte len = 1;
+		while ((dirty >> (first + len)) & 1)
+			len++;
+		writeRegisters((MMA8452Q_Register)(XYZ_DATA_CFG + first), &_shadow[first], len);
+		dirty &= ~(((1ULL << len) - 1) << first);
+		first += len;
+	}
+	_dirty = 0;
+
+	// Return to active state when done
+	// Must be in active state to read data
+	active();
+
+	_fastRead = _ctrl1 & 0x02; // F_READ may have changed
+	_frameValid = false;	   // A cached frame may be at the old scale or resolution
+}
+
+// LOAD SHADOW REGISTERS
+//	Reads the configuration registers into the shadow copy, so that settings
+//	can be changed later without reading them back. The PL_STATUS and _SRC
+//	registers in between are skipped, as reading them would clear their flags.
+//	Returns false if the sensor didn't answer.
+bool MMA8452Q::loadShadow()
+{
+	static const byte runs[][2] = {{XYZ_DATA_CFG, 2}, {PL_CFG, 5}, {FF_MT_THS, 2}, {TRANSIENT_CFG, 1}, {TRANSIENT_THS, 3}, {PULSE_THSX, 15}};
+
+	for (byte r = 0; r < sizeof(runs) / sizeof(runs[0]); r++)
+	{
+		if (!readRegisters((MMA8452Q_Register)runs[r][0], &_shadow[runs[r][0] - XYZ_DATA_CFG], runs[r][1]))
+			return false;
+	}
+	_ctrl1 = shadow(CTRL_REG1);
+	_fastRead = _ctrl1 & 0x02; // Pick up F_READ in case it was left set
+	_dirty = 0;
+	_batching = false;
+	return true;
+}
+
+// STAGE A REGISTER
+//	Puts a new value into a shadow register and marks it to be written by
+//	configure() if the value has changed.
+void MMA8452Q::stageRegister(MMA8452Q_Register reg, byte value)
+{
+	if (shadow(reg) != value)
+	{
+		shadow(reg) = value;
+		_dirty |= 1ULL << (reg - XYZ_DATA_CFG);
+	}
+}
+
+// STAGE BITS OF A REGISTER
+//	Changes only the bits in "mask" of a shadow register to those in "bits".
+void MMA8452Q::stageBits(MMA8452Q_Register reg, byte mask, byte bits)
+{
+	stageRegister(reg, (shadow(reg) & ~mask) | (bits & mask));
+}
+
 // SET STANDBY MODE
-//	Sets the MMA8452 to standby mode. It must be in standby to change most register settings
+//	Sets the MMA8452 to standby mode. It must be in standby to change most register settings.
+//	The last value written to CTRL_REG1 is kept, so no read is needed.
 void MMA8452Q::standby()
 {
-	byte c = readRegister(CTRL_REG1);
-	writeRegister(CTRL_REG1, c & ~(0x01)); //Clear the active bit to go into standby
+	if (_ctrl1 & 0x01)
+	{
+		_ctrl1 &= ~(0x01);				  //Clear the active bit to go into standby
+		writeRegister(CTRL_REG1, _ctrl1);
+	}
 }
 
 // SET ACTIVE MODE
-//	Sets the MMA8452 to active mode. Needs to be in this mode to output data
+//	Sets the MMA8452 to active mode. Needs to be in this mode to output data.
+//	Any staged change to CTRL_REG1 is written at the same time.
 void MMA8452Q::active()
 {
-	byte c = readRegister(CTRL_REG1);
-	writeRegister(CTRL_REG1, c | 0x01); //Set the active bit to begin detection
+	_ctrl1 = shadow(CTRL_REG1) | 0x01; //Set the active bit to begin detection
+	shadow(CTRL_REG1) = _ctrl1;
+	writeRegister(CTRL_REG1, _ctrl1);
 }
 
 // CHECK STATE (ACTIVE or STANDBY)
@@ -393,29 +903,17 @@ void MMA8452Q::writeRegister(MMA8452Q_Register reg, byte data)
 //	auto-incrmenting to the next.
 void MMA8452Q::writeRegisters(MMA8452Q_Register reg, byte *buffer, byte len)
 {
-	_i2cPort->beginTransmission(_deviceAddress);
-	_i2cPort->write(reg);
-	for (int x = 0; x < len; x++)
-		_i2cPort->write(buffer[x]);
-	_i2cPort->endTransmission(); //Stop transmitting
+	_port->write_registers(_deviceAddress, reg, buffer, len);
 }
 
 // READ A SINGLE REGISTER
 //	Read a byte from the MMA8452Q register "reg".
 byte MMA8452Q::readRegister(MMA8452Q_Register reg)
 {
-#ifdef _VARIANT_ARDUINO_DUE_X_
-	_i2cPort->requestFrom((uint8_t)_deviceAddress, (uint8_t)1, (uint32_t)reg, (uint8_t)1, true);
-#else
-	_i2cPort->beginTransmission(_deviceAddress);
-	_i2cPort->write(reg);
-	_i2cPort->endTransmission(false); //endTransmission but keep the connection active
-
-	_i2cPort->requestFrom(_deviceAddress, (byte)1); //Ask for 1 byte, once done, bus is released by default
-#endif
-	if (_i2cPort->available())
-	{							 //Wait for the data to come back
-		return _i2cPort->read(); //Return this one byte
+	byte data;
+	if (_port->read_registers(_deviceAddress, reg, &data, 1))
+	{
+		return data; //Return this one byte
 	}
 	else
 	{
@@ -425,20 +923,8 @@ byte MMA8452Q::readRegister(MMA8452Q_Register reg)
 
 // READ MULTIPLE REGISTERS
 //	Read "len" bytes from the MMA8452Q, starting at register "reg". Bytes are stored
-//	in "buffer" on exit.
-void MMA8452Q::readRegisters(MMA8452Q_Register reg, byte *buffer, byte len)
-{
-#ifdef _VARIANT_ARDUINO_DUE_X_
-	_i2cPort->requestFrom((uint8_t)_deviceAddress, (uint8_t)len, (uint32_t)reg, (uint8_t)1, true);
-#else
-	_i2cPort->beginTransmission(_deviceAddress);
-	_i2cPort->write(reg);
-	_i2cPort->endTransmission(false);			//endTransmission but keep the connection active
-	_i2cPort->requestFrom(_deviceAddress, len); //Ask for bytes, once done, bus is released by default
-#endif
-	if (_i2cPort->available() == len)
-	{
-		for (int x = 0; x < len; x++)
-			buffer[x] = _i2cPort->read();
-	}
+//	in "buffer" on exit. Returns false if fewer than "len" bytes came back.
+bool MMA8452Q::readRegisters(MMA8452Q_Register reg, byte *buffer, byte len)
+{
+	return _port->read_registers(_deviceAddress, reg, buffer, len);
 }
\ No newline at end of file
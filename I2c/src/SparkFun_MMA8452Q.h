@@ -20,6 +20,8 @@ Distributed as-is; no warranty is given.
 
 #include <Arduino.h>
 #include <Wire.h>
+#include "i2c_jobs.h"
+#include "i2c_port.h"
 
 ///////////////////////////////////
 // MMA8452Q Register Definitions //
@@ -103,6 +105,34 @@ enum MMA8452Q_ODR
 #define SYSMOD_WAKE 0b01
 #define SYSMOD_SLEEP 0b10
 
+// Interrupt sources, as bits of CTRL_REG4, CTRL_REG5 and INT_SOURCE
+#define INT_DRDY 0x01
+#define INT_FF_MT 0x04
+#define INT_PULSE 0x08
+#define INT_LNDPRT 0x10
+#define INT_TRANS 0x20
+#define INT_ASLP 0x80
+
+// Axes for motion and transient detection
+#define AXIS_X 0x01
+#define AXIS_Y 0x02
+#define AXIS_Z 0x04
+#define AXES_XYZ 0x07
+
+// One reading of all three axes, taken in a single burst transaction
+struct MMA8452Q_Frame
+{
+	uint32_t time; // micros() when the burst finished
+	short x, y, z; // Signed 12-bit raw values
+};
+
+// One reading of all three axes in fast-read (8-bit) mode
+struct MMA8452Q_Frame8
+{
+	uint32_t time; // micros() when the burst finished
+	int8_t x, y, z; // Signed 8-bit raw values (MSBs only)
+};
+
 ////////////////////////////////
 // MMA8452Q Class Declaration //
 ////////////////////////////////
@@ -114,6 +144,7 @@ class MMA8452Q
 	MMA8452Q_ODR odr;
 
 	bool begin(TwoWire &wirePort = Wire, uint8_t deviceAddress = MMA8452Q_DEFAULT_ADDRESS);
+	bool begin(I2CPort &port, uint8_t deviceAddress = MMA8452Q_DEFAULT_ADDRESS);
 	byte init(MMA8452Q_Scale fsr = SCALE_2G, MMA8452Q_ODR odr = ODR_800);
 	void read();
 	byte available();
@@ -132,6 +163,35 @@ class MMA8452Q
 	float getCalculatedY();
 	float getCalculatedZ();
 
+	bool readFrame(MMA8452Q_Frame &frame);
+	const MMA8452Q_Frame &getFrame();
+	void setFrameMaxAge(uint32_t maxAgeUs);
+
+	void setFastRead(bool enable);
+	bool isFastRead();
+	bool readFrame8(MMA8452Q_Frame8 &frame);
+	static uint32_t frameBusTime(uint32_t clockHz, bool fastRead);
+
+	void enableDataReadyInt(bool useInt1 = true);
+	void disableDataReadyInt();
+
+	void setupMotion(byte threshold, byte count, bool freefall = false, byte axes = AXES_XYZ);
+	void setupTransient(byte threshold, byte count, byte axes = AXES_XYZ, bool highPass = true);
+	void enableEventInt(byte sources, bool useInt1 = true);
+	void disableEventInt(byte sources);
+	byte readInterruptSource();
+	byte readMotion();
+	byte readTransient();
+
+	bool readFrameAsync(I2CJobEngine &engine, I2CJob &job, I2CJobCallback callback = NULL, TaskHandle_t notify = NULL);
+	bool finishFrame(const I2CJob &job, MMA8452Q_Frame &frame);
+
+	void setOffsets(int8_t xOff, int8_t yOff, int8_t zOff);
+	void getOffsets(int8_t &xOff, int8_t &yOff, int8_t &zOff);
+	bool calibrate(uint16_t samples = 64, byte upAxis = AXIS_Z, bool upsideDown = false);
+	void setCalibrationAddress(int eepromAddress);
+	bool isCalibrated();
+
 	bool isRight();
 	bool isLeft();
 	bool isUp();
@@ -141,10 +201,39 @@ class MMA8452Q
 	void setScale(MMA8452Q_Scale fsr);
 	void setDataRate(MMA8452Q_ODR odr);
 
+	void beginConfig();
+	void configure();
+
   private:
 	TwoWire *_i2cPort = NULL; //The generic connection to user's chosen I2C hardware
+	TwoWirePort _wirePort;	  //Register-level port made from _i2cPort by begin(TwoWire&)
+	I2CPort *_port = NULL;	  //Where register reads and writes go: _wirePort or a simulation
 	uint8_t _deviceAddress;   //Keeps track of I2C address. setI2CAddress changes this.
 
+	MMA8452Q_Frame _frame = {};	  //Most recent burst of all three axes
+	bool _frameValid = false;	  //False until a burst succeeds or after the scale changes
+	uint32_t _frameMaxAge = 1250; //How long (us) getX/Y/Z() may serve _frame
+	bool _fastRead = false;		  //True when F_READ is set and only MSBs are read
+
+	byte _shadow[OFF_Z - XYZ_DATA_CFG + 1] = {}; //Copy of the configuration registers
+	uint64_t _dirty = 0;						 //One bit per shadow register changed since configure()
+	bool _batching = false;						 //True between beginConfig() and configure()
+	byte _ctrl1 = 0;							 //Last value written to CTRL_REG1
+
+	byte &shadow(MMA8452Q_Register reg) { return _shadow[reg - XYZ_DATA_CFG]; }
+	bool loadShadow();
+	void stageRegister(MMA8452Q_Register reg, byte value);
+	void stageBits(MMA8452Q_Register reg, byte mask, byte bits);
+
+	int _calAddress = -1;	  //EEPROM address of the saved offsets, or -1 for none
+	bool _calibrated = false; //True once offsets are restored or calibrated
+	bool loadCalibration();
+	void saveCalibration();
+
+	bool frameIsFresh();
+	void decodeFrame(const byte *rawData);
+	byte _asyncData[6]; //Where readFrameAsync() jobs put the raw data
+
 	void standby();
 	void active();
 	bool isActive();
@@ -153,7 +242,7 @@ class MMA8452Q
 	void writeRegister(MMA8452Q_Register reg, byte data);
 	void writeRegisters(MMA8452Q_Register reg, byte *buffer, byte len);
 	byte readRegister(MMA8452Q_Register reg);
-	void readRegisters(MMA8452Q_Register reg, byte *buffer, byte len);
+	bool readRegisters(MMA8452Q_Register reg, byte *buffer, byte len);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,168 @@
+/** @file i2c_jobs.cpp
+ *    This file contains source code for an I2C job engine which lets tasks
+ *    queue up register reads and writes, then go on working while one bus
+ *    task does the transfers.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include "i2c_jobs.h"
+
+
+/** @brief   Create a job engine for an I2C port.
+ *  @details The bus under the port must be started, as with @c Wire.begin(),
+ *           before any jobs are run.
+ *  @param   port The I2C port through which jobs will be run
+ *  @param   queue_size The most jobs which can wait at one time
+ */
+I2CJobEngine::I2CJobEngine (I2CPort& port, uint8_t queue_size)
+    : jobs (queue_size, "I2C jobs", 0)
+{
+    p_port = &port;
+    reset_stats ();
+}
+
+
+/** @brief   Put a job into the queue.
+ *  @details The job's @c done flag is cleared, and the job is placed at the
+ *           back of the queue without waiting. The job must stay in
+ *           existence until it's done.
+ *  @param   job The job, with all its fields filled in
+ *  @returns True if the job was queued, false if the queue was full
+ */
+bool I2CJobEngine::submit (I2CJob& job)
+{
+    job.done = false;
+    job.ok = false;
+    I2CJob* p_job = &job;
+    return jobs.put (p_job);
+}
+
+
+/** @brief   Fill in a job which reads a block of registers and queue it.
+ *  @param   job The job structure to be filled in
+ *  @param   device The I2C address of the device
+ *  @param   reg The first register to be read
+ *  @param   p_data Where to put the bytes which are read
+ *  @param   length The number of bytes to read, at most the size of the
+ *           @c Wire library's buffer if the port uses @c Wire
+ *  @param   callback A function to be called from the bus task when the
+ *           read is done, or @c NULL for none
+ *  @param   notify A task to be given a notification when the read is done,
+ *           or @c NULL for none
+ *  @returns True if the job was queued, false if the queue was full
+ */
+bool I2CJobEngine::read (I2CJob& job, uint8_t device, uint8_t reg,
+                         uint8_t* p_data, uint8_t length,
+                         I2CJobCallback callback, TaskHandle_t notify)
+{
+    job.device = device;
+    job.reg = reg;
+    job.p_data = p_data;
+    job.length = length;
+    job.write = false;
+    job.callback = callback;
+    job.notify = notify;
+    return submit (job);
+}
+
+
+/** @brief   Do one job's transfer on the bus.
+ *  @param   job The job to be done
+ *  @returns True if the device acknowledged and all the bytes moved
+ */
+bool I2CJobEngine::transfer (I2CJob& job)
+{
+    if (job.write)
+    {
+        return p_port->write_registers (job.device, job.reg, job.p_data,
+                                        job.length);
+    }
+    return p_port->read_registers (job.device, job.reg, job.p_data,
+                                   job.length);
+}
+
+
+/** @brief   Wait for a job, run it, and tell its owner that it's done.
+ *  @details The owner is told by calling the job's callback, then by giving
+ *           its task a notification; either or both may be used. The time
+ *           spent on the bus, by the port's clock, is added to the
+ *           statistics.
+ *  @param   wait The longest time in RTOS ticks to wait for a job
+ *  @returns True if a job was run, false if none came in time
+ */
+bool I2CJobEngine::run_one (TickType_t wait)
+{
+    I2CJob* p_job;
+    if (xQueueReceive (jobs.get_handle (), &p_job, wait) != pdTRUE)
+    {
+        return false;
+    }
+
+    uint32_t start = p_port->get_time_us ();
+    p_job->ok = transfer (*p_job);
+    busy_us += p_port->get_time_us () - start;
+    job_count++;
+    if (!p_job->ok)
+    {
+        fail_count++;
+    }
+
+    // Read the notification target first; once done is set, the job's owner
+    // may reuse the job
+    TaskHandle_t notify = p_job->notify;
+    if (p_job->callback != NULL)
+    {
+        p_job->callback (*p_job);
+    }
+    p_job->done = true;
+    if (notify != NULL)
+    {
+        xTaskNotifyGive (notify);
+    }
+    return true;
+}
+
+
+/** @brief   Task function which runs I2C jobs forever.
+ *  @details This task spends its time blocked on the job queue, so it
+ *           should have a higher priority than the tasks which submit jobs
+ *           in order to keep the bus busy.
+ *  @param   p_params A pointer to the @c I2CJobEngine whose jobs are run
+ */
+void I2CJobEngine::task (void* p_params)
+{
+    I2CJobEngine* p_engine = (I2CJobEngine*)p_params;
+
+    for (;;)
+    {
+        p_engine->run_one ();
+    }
+}
+
+
+/** @brief   Find what fraction of the time the bus has been busy.
+ *  @details The times are kept in 32-bit microseconds, which wrap after
+ *           about 71 minutes, so the statistics should be reset more often
+ *           than that, usually each time they're printed.
+ *  @returns The time spent in transfers divided by the time since the
+ *           statistics were reset, from 0.0 to 1.0
+ */
+float I2CJobEngine::get_utilization (void)
+{
+    uint32_t elapsed = p_port->get_time_us () - stats_start;
+    return elapsed ? (float)busy_us / elapsed : 0.0f;
+}
+
+
+/** @brief   Start the statistics over.
+ */
+void I2CJobEngine::reset_stats (void)
+{
+    stats_start = p_port->get_time_us ();
+    busy_us = 0;
+    job_count = 0;
+    fail_count = 0;
+}
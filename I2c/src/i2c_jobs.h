@@ -0,0 +1,132 @@
+/** @file i2c_jobs.h
+ *    This file contains the headers for an I2C job engine. Tasks which need
+ *    to talk to I2C devices put jobs into a queue and carry on with other
+ *    work; one bus task does the transfers in order and tells each job's
+ *    owner when its job is done, either with a callback or with a task
+ *    notification. Since only the bus task touches the bus, drivers used by
+ *    several tasks don't need to lock it. Jobs go through an @c I2CPort, so
+ *    the engine can run on a simulated device as well as on a real bus.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _I2C_JOBS_H_
+#define _I2C_JOBS_H_
+
+#include <Arduino.h>
+#if (defined STM32L4xx || defined STM32F4xx)
+    #include <STM32FreeRTOS.h>
+#endif
+#include "taskqueue.h"
+#include "i2c_port.h"
+
+
+struct I2CJob;
+
+/// Type of a function which the bus task calls when a job has finished
+typedef void (*I2CJobCallback) (I2CJob& job);
+
+
+/** @brief   One I2C transfer to or from a block of a device's registers.
+ *  @details The job and its data buffer belong to the task which submitted
+ *           it and must not be changed or reused until @c done is true.
+ */
+struct I2CJob
+{
+    uint8_t device;                   ///< I2C address of the device
+    uint8_t reg;                      ///< First register to be read/written
+    uint8_t* p_data;                  ///< Data to write or place to read to
+    uint8_t length;                   ///< Number of bytes to transfer
+    bool write;                       ///< True for a write, false for a read
+    I2CJobCallback callback;          ///< Called by the bus task, or NULL
+    TaskHandle_t notify;              ///< Task to be notified, or NULL
+    void* p_context;                  ///< Anything the callback needs
+    volatile bool done;               ///< Set when the job has finished
+    bool ok;                          ///< True if the transfer worked
+};
+
+
+/** @brief   Class which runs queued I2C jobs on one bus.
+ *  @details Jobs are submitted with @c submit() or @c read(), which return
+ *           at once. A task made with @c task() as its function then does
+ *           each transfer and, when one is done, calls the job's callback
+ *           from the bus task and/or gives the job's task a notification:
+ *           @code
+ *           TwoWirePort i2c_port (Wire);
+ *           I2CJobEngine i2c_jobs (i2c_port);
+ *           ...
+ *           xTaskCreate (I2CJobEngine::task, "I2C", 512, &i2c_jobs, 6, NULL);
+ *           ...
+ *           I2CJob job;
+ *           uint8_t data[6];
+ *           i2c_jobs.read (job, 0x1D, 0x01, data, 6, NULL,
+ *                          xTaskGetCurrentTaskHandle ());
+ *           ...                              // Do something else meanwhile
+ *           ulTaskNotifyTake (pdTRUE, portMAX_DELAY);
+ *           @endcode
+ *           The engine also keeps track of how long the bus is busy, so the
+ *           load on a shared bus can be checked with @c get_utilization().
+ *           Drivers which also do blocking transfers must use the same port
+ *           as the engine, so that both kinds go to the same bus.
+ */
+class I2CJobEngine
+{
+protected:
+    /// The I2C port through which jobs are run
+    I2CPort* p_port;
+
+    /// Queue of pointers to jobs waiting to be run
+    Queue<I2CJob*> jobs;
+
+    /// Time in microseconds at which the statistics were last reset
+    uint32_t stats_start;
+
+    /// Total time in microseconds spent doing transfers since then
+    uint32_t busy_us;
+
+    /// Number of jobs run since then
+    uint32_t job_count;
+
+    /// Number of jobs which failed since then
+    uint32_t fail_count;
+
+    // Do one job's transfer on the bus
+    bool transfer (I2CJob& job);
+
+public:
+    // Create a job engine for an I2C port
+    I2CJobEngine (I2CPort& port, uint8_t queue_size = 16);
+
+    // Put a job into the queue
+    bool submit (I2CJob& job);
+
+    // Fill in a read job and put it into the queue
+    bool read (I2CJob& job, uint8_t device, uint8_t reg, uint8_t* p_data,
+               uint8_t length, I2CJobCallback callback = NULL,
+               TaskHandle_t notify = NULL);
+
+    // Wait for a job and run it
+    bool run_one (TickType_t wait = portMAX_DELAY);
+
+    // Task function which runs jobs forever
+    static void task (void* p_params);
+
+    // Find what fraction of the time the bus has been busy
+    float get_utilization (void);
+
+    // Start the statistics over
+    void reset_stats (void);
+
+    /// Return the I2C port through which jobs are run
+    I2CPort& get_port (void) { return *p_port; }
+
+    /// Return the number of jobs run since the statistics were reset
+    uint32_t get_job_count (void) { return job_count; }
+
+    /// Return the number of jobs which failed since the stats were reset
+    uint32_t get_fail_count (void) { return fail_count; }
+};
+
+#endif // _I2C_JOBS_H_
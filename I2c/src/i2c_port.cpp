@@ -0,0 +1,59 @@
+/** @file i2c_port.cpp
+ *    This file contains source code for an I2C port which does register block
+ *    transactions through an Arduino @c TwoWire object.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include "i2c_port.h"
+
+
+/** @brief   Write a block of registers in a device.
+ *  @param   device The device's 7-bit I2C address
+ *  @param   reg The first register to be written
+ *  @param   p_data The bytes to be written
+ *  @param   length The number of bytes to write
+ *  @returns True if the device acknowledged everything, false if not
+ */
+bool TwoWirePort::write_registers (uint8_t device, uint8_t reg,
+                                   const uint8_t* p_data, uint8_t length)
+{
+    p_wire->beginTransmission (device);
+    p_wire->write (reg);
+    p_wire->write (p_data, length);
+    return p_wire->endTransmission () == 0;
+}
+
+
+/** @brief   Read a block of registers from a device.
+ *  @details The register address is written without a stop, so the read
+ *           follows a repeated start and no other master can get in between.
+ *  @param   device The device's 7-bit I2C address
+ *  @param   reg The first register to be read
+ *  @param   p_data Where to put the bytes which are read
+ *  @param   length The number of bytes to read
+ *  @returns True if all the bytes were read, false if not
+ */
+bool TwoWirePort::read_registers (uint8_t device, uint8_t reg,
+                                  uint8_t* p_data, uint8_t length)
+{
+#ifdef _VARIANT_ARDUINO_DUE_X_
+    p_wire->requestFrom (device, length, (uint32_t)reg, (uint8_t)1, true);
+#else
+    p_wire->beginTransmission (device);
+    p_wire->write (reg);
+    p_wire->endTransmission (false);
+    p_wire->requestFrom (device, length);
+#endif
+    if (p_wire->available () != length)
+    {
+        return false;
+    }
+    for (uint8_t index = 0; index < length; index++)
+    {
+        p_data[index] = p_wire->read ();
+    }
+    return true;
+}
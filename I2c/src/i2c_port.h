@@ -0,0 +1,99 @@
+/** @file i2c_port.h
+ *    This file contains the headers for an abstract I2C port through which
+ *    device drivers read and write blocks of registers. A driver written for
+ *    this interface can talk to a real device through @c TwoWirePort, or to
+ *    a simulated device model with no hardware at all.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _I2C_PORT_H_
+#define _I2C_PORT_H_
+
+#include <Arduino.h>
+#include <Wire.h>
+
+
+/** @brief   Abstract interface to an I2C bus, at the level of register blocks.
+ *  @details Each call is one complete transaction: the register address is
+ *           written, then the data is written or, after a repeated start,
+ *           read. Devices are expected to step through their registers as the
+ *           bytes go by.
+ */
+class I2CPort
+{
+public:
+    /** @brief   Destroy a port, including any which is deleted through a
+     *           pointer to this base class.
+     */
+    virtual ~I2CPort (void) { }
+
+    /** @brief   Write a block of registers in a device.
+     *  @param   device The device's 7-bit I2C address
+     *  @param   reg The first register to be written
+     *  @param   p_data The bytes to be written
+     *  @param   length The number of bytes to write
+     *  @returns True if the device acknowledged everything, false if not
+     */
+    virtual bool write_registers (uint8_t device, uint8_t reg,
+                                  const uint8_t* p_data, uint8_t length) = 0;
+
+    /** @brief   Read a block of registers from a device.
+     *  @param   device The device's 7-bit I2C address
+     *  @param   reg The first register to be read
+     *  @param   p_data Where to put the bytes which are read
+     *  @param   length The number of bytes to read
+     *  @returns True if all the bytes were read, false if not
+     */
+    virtual bool read_registers (uint8_t device, uint8_t reg, uint8_t* p_data,
+                                 uint8_t length) = 0;
+
+    /** @brief   Get the time by the clock which the port's transfers take.
+     *  @details A real bus uses @c micros(); a simulated one has its own
+     *           clock, so that time spent on it can be measured.
+     *  @returns The time in microseconds
+     */
+    virtual uint32_t get_time_us (void) { return micros (); }
+};
+
+
+/** @brief   I2C port which uses an Arduino @c TwoWire object such as @c Wire.
+ */
+class TwoWirePort : public I2CPort
+{
+protected:
+    /// The Arduino I2C port through which transactions are done
+    TwoWire* p_wire;
+
+public:
+    /** @brief   Create an I2C port which isn't attached to a bus yet.
+     */
+    TwoWirePort (void) : p_wire (NULL) { }
+
+    /** @brief   Create an I2C port which uses an Arduino I2C port.
+     *  @param   wire The Arduino I2C port, such as @c Wire
+     */
+    TwoWirePort (TwoWire& wire) : p_wire (&wire) { }
+
+    /** @brief   Choose the Arduino I2C port which is to be used.
+     *  @param   wire The Arduino I2C port, such as @c Wire
+     */
+    void attach (TwoWire& wire) { p_wire = &wire; }
+
+    /** @brief   Get the Arduino I2C port in use.
+     *  @returns A pointer to the port, or @c NULL if none has been attached
+     */
+    TwoWire* get_wire (void) { return p_wire; }
+
+    // Write a block of registers in a device
+    bool write_registers (uint8_t device, uint8_t reg, const uint8_t* p_data,
+                          uint8_t length);
+
+    // Read a block of registers from a device
+    bool read_registers (uint8_t device, uint8_t reg, uint8_t* p_data,
+                         uint8_t length);
+};
+
+#endif // _I2C_PORT_H_
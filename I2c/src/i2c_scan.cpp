@@ -0,0 +1,217 @@
+/** @file i2c_scan.cpp
+ *    This file contains source code for an I2C bus discovery service which
+ *    finds the devices on a bus in a few milliseconds, remembers them in
+ *    EEPROM, and prints a table of them.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include <PrintStream.h>
+#include <EEPROM.h>
+#include "i2c_scan.h"
+
+
+/// The EEPROM address at which the map of devices is saved
+const uint16_t SCAN_EEPROM_ADDR = 0;
+
+/// A number which shows that the EEPROM holds a saved map
+const uint16_t SCAN_MAGIC = 0x12C5;
+
+/// The lowest and highest addresses which aren't reserved by the I2C spec
+const uint8_t FIRST_ADDR = 0x08;
+const uint8_t LAST_ADDR = 0x77;
+
+
+/// The map of devices as it's saved in EEPROM
+struct ScanRecord
+{
+    uint16_t magic;                   ///< @c SCAN_MAGIC if a map was saved
+    uint8_t present[16];              ///< Devices which were found
+    uint8_t check;                    ///< Checksum of @c present
+};
+
+
+/** @brief   Compute a simple checksum of a presence bitmap.
+ *  @param   p_bits The 16 bytes of the bitmap
+ *  @returns The checksum
+ */
+static uint8_t bitmap_check (const uint8_t* p_bits)
+{
+    uint8_t sum = 0xA5;
+    for (uint8_t index = 0; index < 16; index++)
+    {
+        sum = (sum << 1 | sum >> 7) ^ p_bits[index];
+    }
+    return sum;
+}
+
+
+/** @brief   See if a device acknowledges its address.
+ *  @param   bus The I2C bus on which to look
+ *  @param   addr The address to try
+ *  @returns The result from @c endTransmission(): 0 if a device answered,
+ *           2 or 3 if nothing did, or another number for a bus error
+ */
+static uint8_t probe (TwoWire& bus, uint8_t addr)
+{
+    bus.beginTransmission (addr);
+    return bus.endTransmission ();
+}
+
+
+/** @brief   Find which addresses on a bus have devices.
+ *  @details If a map of devices was saved at an earlier startup, only the
+ *           devices in it are probed; if they all answer, the saved map is
+ *           used and discovery takes one probe per device. Otherwise, or if
+ *           @c rescan is true, every address is probed and the new map is
+ *           saved if it's different. A saved map with no devices in it is
+ *           never trusted, since a bus which was empty once, perhaps because
+ *           it wasn't plugged in, would otherwise never be scanned again. A
+ *           device which is added while all the old ones stay won't be seen
+ *           until a rescan is asked for.
+ *
+ *           Probing is done at a fast clock with a short timeout, where the
+ *           @c Wire library supports timeouts, so an empty address costs
+ *           tens of microseconds rather than a long wait.
+ *  @param   bus The I2C bus on which to look, which must have been started
+ *  @param   found The map in which to put the results
+ *  @param   rescan True to probe every address even if a map was saved
+ *  @param   probe_hz The clock speed to use while probing
+ *  @param   run_hz The clock speed to which the bus is set afterwards
+ *  @param   timeout_us The longest time to wait for each probe
+ *  @returns The number of devices found
+ */
+uint8_t I2C_discover (TwoWire& bus, I2CPresence& found, bool rescan,
+                      uint32_t probe_hz, uint32_t run_hz, uint16_t timeout_us)
+{
+    bus.setClock (probe_hz);
+    #ifdef WIRE_HAS_TIMEOUT
+        bus.setWireTimeout (timeout_us, true);
+    #else
+        (void)timeout_us;
+    #endif
+    memset (&found, 0, sizeof (found));
+
+    // If there's a saved map, check that the devices in it are still there
+    ScanRecord saved;
+    EEPROM.get (SCAN_EEPROM_ADDR, saved);
+    bool valid = saved.magic == SCAN_MAGIC
+                 && saved.check == bitmap_check (saved.present);
+    uint8_t any_saved = 0;
+    for (uint8_t index = 0; index < sizeof (saved.present); index++)
+    {
+        any_saved |= saved.present[index];
+    }
+    bool verified = valid && any_saved && !rescan;
+    for (uint8_t addr = FIRST_ADDR; verified && addr <= LAST_ADDR; addr++)
+    {
+        if (saved.present[addr >> 3] & (1 << (addr & 7)))
+        {
+            verified = (probe (bus, addr) == 0);
+        }
+    }
+
+    // If anything has changed, probe every address and save the new map
+    if (verified)
+    {
+        memcpy (found.present, saved.present, sizeof (found.present));
+    }
+    else
+    {
+        found.scanned = true;
+        for (uint8_t addr = FIRST_ADDR; addr <= LAST_ADDR; addr++)
+        {
+            uint8_t error = probe (bus, addr);
+            if (error == 0)
+            {
+                found.present[addr >> 3] |= 1 << (addr & 7);
+            }
+            else if (error != 2 && error != 3)
+            {
+                found.faulty[addr >> 3] |= 1 << (addr & 7);
+            }
+        }
+
+        if (!valid || memcmp (saved.present, found.present,
+                              sizeof (found.present)) != 0)
+        {
+            saved.magic = SCAN_MAGIC;
+            memcpy (saved.present, found.present, sizeof (saved.present));
+            saved.check = bitmap_check (saved.present);
+            EEPROM.put (SCAN_EEPROM_ADDR, saved);
+        }
+    }
+    bus.setClock (run_hz);
+
+    uint8_t count = 0;
+    for (uint8_t addr = FIRST_ADDR; addr <= LAST_ADDR; addr++)
+    {
+        count += found.is_present (addr);
+    }
+    return count;
+}
+
+
+/** @brief   Print a table of the devices in a presence map.
+ *  @details The printed symbols are:
+ *           * @b - No device found at this I2C bus address
+ *           * @b @@ A device was found at this address
+ *           * @b ? A bus error or timeout happened at this address
+ *  @param   found The map of devices to be printed
+ *  @param   printer A reference to the stream such as @c Serial on which the
+ *           table is to be printed
+ */
+void I2C_print_map (const I2CPresence& found, Print& printer)
+{
+    // Print a header for the table
+    printer << "    0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F" << hex
+            << endl;
+
+    for (uint8_t row = 0x00; row <= 0x70; row += 0x10)      // Rows are 16's
+    {
+        printer << row << " ";                              // Columns are 1's
+        for (uint8_t col = 0; col <= 0x0F; col++)
+        {
+            uint8_t addr = row | col;
+            if (addr < FIRST_ADDR || addr > LAST_ADDR)      // Don't do these
+            {
+                printer << "   ";
+            }
+            else if (found.is_present (addr)) printer << " @ ";
+            else if (found.is_faulty (addr))  printer << " ? ";
+            else                              printer << " - ";
+        }
+        printer << endl;
+    }
+    printer << dec;
+}
+
+
+/** @brief   Find the devices on a bus and print a table of them.
+ *  @details Discovery is done first, using the saved map if it's still
+ *           correct, and the table is printed afterwards so that slow serial
+ *           output doesn't stretch out the probing. If the saved map was
+ *           used, a note says so, as a newly added device won't be in it.
+ *  @param   bus A reference to the I2C/Two-Wire bus to be scanned
+ *  @param   printer A reference to the stream such as @c Serial on which the
+ *           results of the scan are to be printed
+ *  @param   rescan True to probe every address even if a map was saved
+ */
+void I2C_scan (TwoWire& bus, Print& printer, bool rescan)
+{
+    I2CPresence found;
+
+    uint32_t start = micros ();
+    uint8_t count = I2C_discover (bus, found, rescan);
+    uint32_t took = micros () - start;
+
+    I2C_print_map (found, printer);
+    printer << count << " devices found in " << took << " us" << endl;
+    if (!found.scanned)
+    {
+        printer << "(Saved map; press a key while the board starts up to "
+                << "look for new devices)" << endl;
+    }
+}
@@ -0,0 +1,57 @@
+/** @file i2c_scan.h
+ *    This file contains the headers for an I2C bus discovery service. The bus
+ *    is probed quickly, with a short timeout and a fast clock, and the
+ *    addresses at which devices answer are kept in a bitmap. The bitmap is
+ *    saved in EEPROM, so that on later startups only the devices which were
+ *    found before need to be checked, and the table of devices is printed
+ *    from the bitmap after the probing is done.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _I2C_SCAN_H_
+#define _I2C_SCAN_H_
+
+#include <Arduino.h>
+#include <Wire.h>
+
+
+/** @brief   Bitmaps of which I2C addresses have devices.
+ *  @details One bit is kept for each 7-bit address; bit @c (addr & 7) of
+ *           byte @c (addr >> 3) belongs to address @c addr.
+ */
+struct I2CPresence
+{
+    uint8_t present[16];              ///< Devices which acknowledged
+    uint8_t faulty[16];               ///< Addresses which timed out or erred
+    bool scanned;                     ///< True if every address was probed
+
+    /// Check whether a device answered at an address
+    bool is_present (uint8_t addr) const
+    {
+        return present[addr >> 3] & (1 << (addr & 7));
+    }
+
+    /// Check whether probing an address caused a bus error
+    bool is_faulty (uint8_t addr) const
+    {
+        return faulty[addr >> 3] & (1 << (addr & 7));
+    }
+};
+
+
+// Find which addresses on a bus have devices, using the saved map if it's
+// still correct
+uint8_t I2C_discover (TwoWire& bus, I2CPresence& found, bool rescan = false,
+                      uint32_t probe_hz = 400000, uint32_t run_hz = 100000,
+                      uint16_t timeout_us = 500);
+
+// Print a table of the devices in a presence map
+void I2C_print_map (const I2CPresence& found, Print& printer);
+
+// Find the devices on a bus and print a table of them
+void I2C_scan (TwoWire& bus, Print& printer, bool rescan = false);
+
+#endif // _I2C_SCAN_H_
@@ -13,6 +13,9 @@
  * 
  *  @date    28 Sep 2020 Original file
  *  @date    01 Nov 2020 Let's make an example of an accelerometer
+ *  @date    18 Oct 2026 Fuse readings into pitch and roll at the data rate
+ *  @date    18 Oct 2026 Sample on the data ready interrupt into a queue
+ *  @date    18 Oct 2026 Read frames through the I2C job engine
  */
 
 #include <Arduino.h>
@@ -22,55 +25,173 @@
 #endif
 
 #include <Wire.h>
+#include "i2c_scan.h"
 #include "SparkFun_MMA8452Q.h"
+#include "mma8452q_accel.h"
+#include "tilt_fusion.h"
+#include "mma8452q_registers.h"
+#include "taskqueue.h"
+#include "i2c_jobs.h"
 
 
-/** @brief   Scan the I2C bus and print a table of the devices which have been
- *           found.
- *  @details This function is modified from the example at
- *           @c https://playground.arduino.cc/Main/I2cScanner/. The printed
- *           symbols are:
- *           * @b - No device found at this I2C bus address
- *           * @b @@ No error; a device was found at this address
- *           * @b t The I2C bus timed out trying to read from this address
- *           * @b ? Unknown error when trying to find a device at this address
- *  @param   bus A reference to the I2C/Two-Wire bus to be scanned
+/** @brief   Print how much of the I2C bus an MMA8452Q uses at each data rate.
+ *  @details For each output data rate, the time one frame read holds the bus
+ *           is compared with the sample period, in both 12-bit and 8-bit
+ *           (fast-read) modes, at 100 kHz and 400 kHz. This shows which
+ *           resolution leaves enough bus time for the other devices.
  *  @param   printer A reference to the stream such as @c Serial on which the
- *           results of the scan are to be printed
+ *           table is to be printed
  */
 
-void I2C_scan (TwoWire& bus, Stream& printer)
+void print_bus_times (Print& printer)
 {
-    // Print a header for the table
-    printer << "    0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F" << hex 
-            << endl;
+    const char* rates[] = {"800", "400", "200", "100", "50", "12.5", "6.25",
+                           "1.56"};
+    const uint32_t periods[] = {1250, 2500, 5000, 10000, 20000, 80000,
+                                160000, 640000};
+    const uint32_t clocks[] = {100000, 400000};
 
-    for (uint8_t row = 0x00; row <= 0x70; row += 0x10)      // Rows are 16's
+    printer << "Bus use (%) by frame reads" << endl
+            << "ODR Hz\t  12b@100k  8b@100k  12b@400k  8b@400k" << endl;
+    for (uint8_t odr = ODR_800; odr <= ODR_1; odr++)
     {
-        printer << row << " ";                              // Columns are 1's
-        for (uint8_t col = 0; col <= 0x0F; col++)
+        printer << rates[odr] << "\t";
+        for (uint8_t clock = 0; clock < 2; clock++)
         {
-            if (row == 0 && col < 8)                        // Don't do these
+            for (uint8_t fast = 0; fast < 2; fast++)
             {
-                printer << "   ";
-            }
-            else
-            {
-                bus.beginTransmission (row | col);
-                uint8_t error = bus.endTransmission ();
-                if (error == 0)                    printer << " @ ";
-                else if (error == 1)               printer << " t ";
-                else if (error == 2 or error == 3) printer << " - ";
-                else                               printer << " ? ";
+                uint32_t busy = MMA8452Q::frameBusTime (clocks[clock], fast);
+                printer << "  " << (busy * 1000 / periods[odr]) / 10.0f;
             }
         }
         printer << endl;
     }
-    printer << dec;
 }
 
 
-/** @brief   Task which talks to an accelerometer periodically.
+/// The pin to which the MMA8452Q's INT1 output is connected
+const uint8_t ACCEL_INT1_PIN = D2;
+
+/// The pin to which the MMA8452Q's INT2 output, used for motion, is connected
+const uint8_t ACCEL_INT2_PIN = D3;
+
+/// How long in milliseconds sampling goes on after the last motion event
+const uint32_t IDLE_AFTER_MS = 2000;
+
+/// The accelerometer, which the sampling task reads
+MMA8452Q accel;
+
+/// Frames from the sampling task, each stamped with its data ready time
+Queue<MMA8452Q_Frame> accel_frames (32, "Frames", 0);
+
+/// The frames from the sampling task, given out to users as batches
+MMA8452QAccel accel_source (accel, accel_frames);
+
+/// Handle of the sampling task, which the data ready interrupt wakes up
+TaskHandle_t sampler_handle = NULL;
+
+/// The time in microseconds at which the latest data ready interrupt came
+volatile uint32_t drdy_time = 0;
+
+/// Set by the data ready interrupt, cleared when the sampling task sees it
+volatile bool data_ready = false;
+
+/// Set by the motion interrupt, cleared when the sampling task sees it
+volatile bool motion_event = false;
+
+/// Number of times motion has started sampling again after it went idle
+volatile uint32_t wakeups = 0;
+
+/// Number of frames which had to be thrown away because the queue was full
+volatile uint32_t frames_dropped = 0;
+
+/// Number of samples which the sensor made but which weren't read in time
+volatile uint32_t frames_missed = 0;
+
+/// The port through which the driver and the job engine both reach the bus
+TwoWirePort i2c_port (Wire);
+
+/// The engine which runs all transfers on the I2C bus once sampling starts
+I2CJobEngine i2c_jobs (i2c_port);
+
+/// What the bus task needs to finish a frame read for the sampling task
+struct FrameRead
+{
+    MMA8452Q* p_accel;                  ///< The driver which started the read
+    uint32_t time;                      ///< When the data ready interrupt came
+};
+
+
+/** @brief   Callback which the bus task runs when a frame read is done.
+ *  @details The raw data is turned into a frame, which is stamped with the
+ *           data ready time and put into @c accel_frames.
+ *  @param   job The finished job, whose context points to a @c FrameRead
+ */
+void frame_read_done (I2CJob& job)
+{
+    FrameRead* p_read = (FrameRead*)job.p_context;
+    MMA8452Q_Frame frame;
+
+    if (p_read->p_accel->finishFrame (job, frame))
+    {
+        frame.time = p_read->time;
+        if (!accel_frames.put (frame))
+        {
+            frames_dropped++;
+        }
+    }
+}
+
+
+/** @brief   Interrupt service routine for the accelerometer's data ready pin.
+ *  @details This routine saves the time and wakes the sampling task with a
+ *           task notification; the I2C reading is done in the task, as the
+ *           @c Wire library can't be used from an interrupt.
+ */
+void drdy_isr (void)
+{
+    BaseType_t woken = pdFALSE;
+
+    drdy_time = micros ();
+    data_ready = true;
+    vTaskNotifyGiveFromISR (sampler_handle, &woken);
+    portYIELD_FROM_ISR (woken);
+}
+
+
+/** @brief   Interrupt service routine for the accelerometer's motion pin.
+ *  @details The accelerometer's transient engine pulls INT2 low when it
+ *           feels a jolt. This routine just wakes the sampling task, which
+ *           clears the event and starts sampling if it had gone idle.
+ */
+void motion_isr (void)
+{
+    BaseType_t woken = pdFALSE;
+
+    motion_event = true;
+    vTaskNotifyGiveFromISR (sampler_handle, &woken);
+    portYIELD_FROM_ISR (woken);
+}
+
+
+/** @brief   Task which reads the accelerometer each time it has new data.
+ *  @details The accelerometer's data ready signal is sent to its INT1 pin,
+ *           whose interrupt wakes this task. Each wakeup queues exactly one
+ *           burst read of the data registers, and no reads of @c STATUS, on
+ *           the I2C job engine, so this task never waits for the bus. When
+ *           the read is done, the bus task stamps the frame with the
+ *           interrupt's time and puts it into @c accel_frames. Since the
+ *           INT1 pin stays low until the data is read, a wakeup is missed
+ *           only if this task falls a whole sample behind. Gaps between
+ *           interrupt times are counted in @c frames_missed, and if no
+ *           interrupt comes for a while, a read is done anyway to free the
+ *           pin.
+ *
+ *           The accelerometer's transient engine sends motion events to
+ *           INT2. If there has been no motion for @c IDLE_AFTER_MS, this
+ *           task stops reading; INT1 then stays low, so there are no more
+ *           interrupts, and the task sleeps with no bus traffic until the
+ *           next motion event, which starts sampling again.
  *  @param   p_params Pointer to parameters passed to this function; we don't
  *           expect to be passed anything and so ignore this pointer
  */
@@ -80,13 +201,22 @@ void task_accelerometer (void* p_params)
 
     // Initialize the I2C bus and accelerometer driver
     Wire.begin ();
-    MMA8452Q accel;                     // Create instance of the MMA8452 class
 
-    // Run a scan and show where devices are found on the I2C bus
-    I2C_scan (Wire, Serial);
+    // Find the devices on the I2C bus and show where they are, then run the
+    // bus fast enough for 800 Hz sampling. A key pressed while the board
+    // was starting up asks for every address to be probed again
+    bool rescan = Serial.available () > 0;
+    while (Serial.available ())
+    {
+        Serial.read ();
+    }
+    I2C_scan (Wire, Serial, rescan);
+    Wire.setClock (400000);
 
-    // Try to initialize the accelerometer; if it doesn't work, stop this task
-    if (accel.begin (Wire, 0x1D) == false)
+    // Try to initialize the accelerometer; if it doesn't work, stop this task.
+    // Offsets are kept in EEPROM after the I2C scanner's map of devices
+    accel.setCalibrationAddress (32);
+    if (accel.begin (i2c_port, 0x1D) == false)
     {
         Serial.println ("No MMA8452Q has been found.");
         while (true)
@@ -95,19 +225,186 @@ void task_accelerometer (void* p_params)
         }
     }
 
-    // If the accelerometer does work, ask it for accelerations
+    // The first time, find the offsets which zero the accelerometer's bias
+    if (!accel.isCalibrated ())
+    {
+        Serial << "Calibrating the MMA8452Q; keep it flat and still" << endl;
+        if (!accel.calibrate (256))
+        {
+            Serial << "Calibration failed" << endl;
+        }
+    }
+
+    // Show how the accelerometer has been configured
+    Serial << "MMA8452Q configuration:" << endl;
+    print_registers (Serial, Wire, 0x1D, MMA8452Q_CONFIG_REGS,
+                     MMA8452Q_NUM_CONFIG_REGS);
+    print_bus_times (Serial);
+
+    // Send data ready to INT1 and motion to INT2, and have the falling edge
+    // of either one wake this task
+    sampler_handle = xTaskGetCurrentTaskHandle ();
+    pinMode (ACCEL_INT1_PIN, INPUT);
+    pinMode (ACCEL_INT2_PIN, INPUT);
+    attachInterrupt (digitalPinToInterrupt (ACCEL_INT1_PIN), drdy_isr,
+                     FALLING);
+    attachInterrupt (digitalPinToInterrupt (ACCEL_INT2_PIN), motion_isr,
+                     FALLING);
+    accel.beginConfig ();
+    accel.setupTransient (4, 8);        // 0.25 g for 10 ms on any axis
+    accel.enableEventInt (INT_TRANS, false);
+    accel.enableDataReadyInt ();
+    accel.configure ();
+
+    const uint32_t period = 1250;       // Sample period (us) at ODR_800
+    uint32_t last_time = micros ();     // Time of the previous interrupt
+    FrameRead read = {&accel, 0};       // Passed to frame_read_done()
+    I2CJob job;                         // The job which reads each frame
+    job.p_context = &read;
+    I2CJob event_job;                   // The job which clears motion events
+    event_job.done = true;
+    uint8_t transient_src;              // Where event_job puts TRANSIENT_SRC
+    bool sampling = true;               // False while idle, waiting for motion
+    uint32_t last_motion = millis ();   // Time of the latest motion event
+    motion_event = true;                // Clear any event from before now
+
+    // From here on only the bus task uses the bus. Read once in case INT1
+    // went low before the interrupt was attached
+    i2c_jobs.reset_stats ();
+    accel.readFrameAsync (i2c_jobs, job, frame_read_done);
+
     for (;;)
     {
-        vTaskDelay (5000);              // Wait a few seconds
+        // Wait for data, or while idle, for as long as it takes to see motion
+        bool woken = ulTaskNotifyTake (pdTRUE, sampling ? pdMS_TO_TICKS (20)
+                                                        : portMAX_DELAY) != 0;
+
+        // Read TRANSIENT_SRC to clear each motion event so INT2 can signal
+        // the next one, and start sampling again if it had stopped
+        if (motion_event && event_job.done)
+        {
+            motion_event = false;
+            i2c_jobs.read (event_job, 0x1D, TRANSIENT_SRC, &transient_src, 1);
+            last_motion = millis ();
+            if (!sampling)
+            {
+                // Reading a frame frees INT1, so data ready interrupts resume
+                sampling = true;
+                wakeups++;
+                data_ready = false;
+                last_time = micros ();
+                read.time = last_time;
+                accel.readFrameAsync (i2c_jobs, job, frame_read_done);
+                continue;
+            }
+        }
+        if (!sampling || !job.done)
+        {
+            continue;                   // Idle, or the last read is under way
+        }
 
-        if (accel.available ())         // If accelerometer data is ready
+        // After a while with no motion, stop reading and leave INT1 low
+        if (event_job.done && millis () - last_motion > IDLE_AFTER_MS)
+        {
+            sampling = false;
+            continue;
+        }
+        if (!woken)
         {
-            Serial.print (accel.getCalculatedX ());
-            Serial << " ";
+            // No interrupt came, so the pin may be stuck low; read to free it
+            accel.readFrameAsync (i2c_jobs, job, frame_read_done);
+            continue;
         }
-        else
+        if (!data_ready)
+        {
+            continue;                   // Woken by motion, not by new data
+        }
+        data_ready = false;
+
+        uint32_t captured = drdy_time;
+        read.time = captured;
+        accel.readFrameAsync (i2c_jobs, job, frame_read_done);
+
+        // A gap of more than one and a half periods means a sample was lost
+        uint32_t gap = captured - last_time;
+        if (gap > period + period / 2)
         {
-            Serial << " - ";
+            frames_missed += (gap + period / 2) / period - 1;
+        }
+        last_time = captured;
+    }
+}
+
+
+/** @brief   Task which computes tilt angles from accelerometer frames.
+ *  @details Frames are taken from an accelerometer in batches and each one
+ *           is given to a tilt estimator. This task doesn't depend on which
+ *           kind of sensor it's given. Every half second the angles are
+ *           printed along with the number of CPU cycles the most recent
+ *           estimator update took, measured with the Cortex-M cycle counter,
+ *           and the counts of lost frames.
+ *  @param   p_params Pointer to the @c IAccelerometer to be used
+ */
+void task_tilt (void* p_params)
+{
+    IAccelerometer* p_sensor = (IAccelerometer*)p_params;
+    if (!p_sensor->begin ())
+    {
+        Serial << "The tilt sensor didn't start" << endl;
+        while (true)
+        {
+            vTaskDelay (10000);
+        }
+    }
+
+    // Turn on the CPU's cycle counter so we can see how long fusion takes
+    #ifdef DWT
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    #endif
+
+    TiltFusion tilt (FUSION_EKF);       // Estimates pitch and roll
+    AccelFrame frames[8];               // A batch of frames from the sensor
+    uint32_t last_sample = 0;           // Time of the previous reading
+    bool first = true;                  // No time step for the first frame
+    uint32_t last_print = millis ();    // Time of the previous printout
+    uint32_t cycles = 0;                // CPU cycles for one fusion update
+
+    for (;;)
+    {
+        uint16_t count = p_sensor->read_frames (frames, 8);
+        float g_per_count = p_sensor->get_scale ();
+        for (uint16_t index = 0; index < count; index++)
+        {
+            const AccelFrame& frame = frames[index];
+            float dt = first ? 0.0f : (frame.time - last_sample) * 1.0e-6f;
+            last_sample = frame.time;
+            first = false;
+
+            #ifdef DWT
+                uint32_t start = DWT->CYCCNT;
+            #endif
+            tilt.update (frame.x * g_per_count, frame.y * g_per_count,
+                         frame.z * g_per_count, dt);
+            #ifdef DWT
+                cycles = DWT->CYCCNT - start;
+            #endif
+        }
+
+        if (millis () - last_print >= 500)
+        {
+            last_print = millis ();
+            Serial << "Pitch " << degrees (tilt.get_pitch ()) 
+                   << " Roll " << degrees (tilt.get_roll ()) 
+                   << " (" << cycles << " cycles, " << frames_missed
+                   << " missed, " << frames_dropped << " dropped, "
+                   << wakeups << " wakeups, bus "
+                   << i2c_jobs.get_utilization () * 100.0f << "%)" << endl;
+
+            // Each figure covers only the time since the last one, so the
+            // microsecond counts never get near wrapping around
+            i2c_jobs.reset_stats ();
         }
     }
 }
@@ -127,16 +424,28 @@ void setup ()
     Serial << endl << endl << "\033[2JHello, I am a demonstration." << endl;
     Serial << "I will talk to an accelerometer through I2C." << endl << endl;
 
-    // Specify which pin is to be used to send the PWM and make a pointer to it
-    // The variable must be static so it exists when the task function runs
-    static uint8_t pin_for_PWM = A3;
+    // Create a task which runs I2C transfers for the other tasks
+    xTaskCreate (I2CJobEngine::task,
+                 "I2C",                           // Name for printouts
+                 512,                             // Stack size
+                 &i2c_jobs,                       // Parameter(s) for task fn.
+                 6,                               // Priority
+                 NULL);                           // Task handle
 
-    // Create a task which prints a slightly disagreeable message
+    // Create a task which reads the accelerometer whenever it has data
     xTaskCreate (task_accelerometer,
-                 "PWM Ramp",                      // Name for printouts
-                 200,                             // Stack size
-                 (void*)(&pin_for_PWM),           // Parameter(s) for task fn.
-                 4,                               // Priority
+                 "Accel",                         // Name for printouts
+                 1024,                            // Stack size
+                 NULL,                            // Parameter(s) for task fn.
+                 5,                               // Priority
+                 NULL);                           // Task handle
+
+    // Create a task which turns accelerometer frames into tilt angles
+    xTaskCreate (task_tilt,
+                 "Tilt",                          // Name for printouts
+                 1024,                            // Stack size
+                 &accel_source,                   // Parameter(s) for task fn.
+                 3,                               // Priority
                  NULL);                           // Task handle
 
     // If using an STM32, we need to call the scheduler startup function now;
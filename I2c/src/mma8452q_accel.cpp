@@ -0,0 +1,70 @@
+/** @file mma8452q_accel.cpp
+ *    This file contains source code for an @c IAccelerometer adapter which
+ *    gives out frames read from an MMA8452Q.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include "mma8452q_accel.h"
+
+
+/** @brief   Create an adapter for an MMA8452Q and its queue of frames.
+ *  @param   accel The driver for the sensor
+ *  @param   frames The queue into which a sampling task puts frames
+ */
+MMA8452QAccel::MMA8452QAccel (MMA8452Q& accel, Queue<MMA8452Q_Frame>& frames)
+    : p_accel (&accel), p_frames (&frames)
+{
+}
+
+
+/** @brief   Get the frames which the sampling task has read.
+ *  @details This method waits for the first frame, then takes every frame
+ *           which is in the queue, up to @c max, without waiting. The queue
+ *           is read through its handle, as @c Queue::get() waits for the
+ *           time given to the queue's constructor.
+ *  @param   p_out An array into which the frames are put
+ *  @param   max The largest number of frames to put into @c p_out
+ *  @returns The number of frames put into @c p_out
+ */
+uint16_t MMA8452QAccel::read_frames (AccelFrame* p_out, uint16_t max)
+{
+    MMA8452Q_Frame frame;
+    uint16_t count = 0;
+    TickType_t wait = portMAX_DELAY;
+
+    while (count < max
+           && xQueueReceive (p_frames->get_handle (), &frame, wait) == pdTRUE)
+    {
+        p_out[count].time = frame.time;
+        p_out[count].x = frame.x;
+        p_out[count].y = frame.y;
+        p_out[count].z = frame.z;
+        count++;
+        wait = 0;
+    }
+    return count;
+}
+
+
+/** @brief   Get the scale of the frames.
+ *  @details Frames are in 12-bit counts, so 2048 counts is full scale.
+ *  @returns The number of g's in one count
+ */
+float MMA8452QAccel::get_scale (void)
+{
+    return (float)p_accel->scale / 2048.0f;
+}
+
+
+/** @brief   Get the data rate set in the driver.
+ *  @returns The number of readings the sensor takes each second
+ */
+float MMA8452QAccel::get_odr (void)
+{
+    static const float rates[] = {800.0f, 400.0f, 200.0f, 100.0f, 50.0f,
+                                  12.5f, 6.25f, 1.56f};
+    return rates[p_accel->odr];
+}
@@ -0,0 +1,59 @@
+/** @file mma8452q_accel.h
+ *    This file contains the headers for an @c IAccelerometer adapter which
+ *    gives out the frames which a sampling task has read from an MMA8452Q
+ *    and put into a queue.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _MMA8452Q_ACCEL_H_
+#define _MMA8452Q_ACCEL_H_
+
+#include <Arduino.h>
+#include "accelerometer.h"
+#include "SparkFun_MMA8452Q.h"
+#include "taskqueue.h"
+
+
+/** @brief   Adapter which lets an MMA8452Q be used as an @c IAccelerometer.
+ *  @details The sensor is read by a sampling task, which knows the best way
+ *           to read it (for example on its data ready interrupt), and which
+ *           puts frames into a queue. This adapter takes them out in
+ *           batches. Its scale and data rate are those set in the driver.
+ *           @code
+ *           MMA8452Q accel;
+ *           Queue<MMA8452Q_Frame> accel_frames (32, "Frames", 0);
+ *           MMA8452QAccel accel_source (accel, accel_frames);
+ *           ...
+ *           xTaskCreate (task_tilt, "Tilt", 1024, &accel_source, 3, NULL);
+ *           @endcode
+ */
+class MMA8452QAccel : public IAccelerometer
+{
+protected:
+    /// The driver, from which the scale and data rate are found
+    MMA8452Q* p_accel;
+
+    /// The queue into which the sampling task puts frames
+    Queue<MMA8452Q_Frame>* p_frames;
+
+public:
+    // Create an adapter for an MMA8452Q and its queue of frames
+    MMA8452QAccel (MMA8452Q& accel, Queue<MMA8452Q_Frame>& frames);
+
+    // The sampling task starts the sensor, so there's nothing to do here
+    bool begin (void) { return true; }
+
+    // Get the frames which the sampling task has read
+    uint16_t read_frames (AccelFrame* p_out, uint16_t max);
+
+    // Get the number of g's in one count
+    float get_scale (void);
+
+    // Get the number of readings the sensor takes each second
+    float get_odr (void);
+};
+
+#endif // _MMA8452Q_ACCEL_H_
@@ -0,0 +1,171 @@
+/** @file mma8452q_registers.cpp
+ *    This file contains descriptions of the MMA8452Q accelerometer's
+ *    configuration registers, taken from the data sheet. Registers such as
+ *    @c STATUS, @c PL_STATUS and the @c _SRC registers are left out because
+ *    reading them clears the flags they report, which would interfere with
+ *    the driver.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include "mma8452q_registers.h"
+#include "SparkFun_MMA8452Q.h"
+
+
+/// Names of the full scale ranges in XYZ_DATA_CFG
+constexpr const char* FS_NAMES[] = {"2g", "4g", "8g", "reserved"};
+
+/// Names of the output data rates in CTRL_REG1
+constexpr const char* DR_NAMES[] = {"800Hz", "400Hz", "200Hz", "100Hz",
+                                    "50Hz", "12.5Hz", "6.25Hz", "1.56Hz"};
+
+/// Names of the auto-sleep data rates in CTRL_REG1
+constexpr const char* ASLP_NAMES[] = {"50Hz", "12.5Hz", "6.25Hz", "1.56Hz"};
+
+/// Names of the oversampling modes in CTRL_REG2
+constexpr const char* MODS_NAMES[] = {"normal", "lnlp", "hires", "lowpwr"};
+
+/// Names of the interrupt pins in CTRL_REG5
+constexpr const char* PIN_NAMES[] = {"INT2", "INT1"};
+
+constexpr RegisterField XYZ_DATA_CFG_FIELDS[] =
+{
+    reg_field ("HPF_OUT", 4),
+    reg_field ("FS", 0, 2, FS_NAMES)
+};
+
+constexpr RegisterField HP_FILTER_CUTOFF_FIELDS[] =
+{
+    reg_field ("PULSE_HPF_BYP", 5),
+    reg_field ("PULSE_LPF_EN", 4),
+    reg_field ("SEL", 0, 2)
+};
+
+constexpr RegisterField PL_CFG_FIELDS[] =
+{
+    reg_field ("DBCNTM", 7),
+    reg_field ("PL_EN", 6)
+};
+
+constexpr RegisterField FF_MT_CFG_FIELDS[] =
+{
+    reg_field ("ELE", 7),
+    reg_field ("OAE", 6),
+    reg_field ("ZEFE", 5),
+    reg_field ("YEFE", 4),
+    reg_field ("XEFE", 3)
+};
+
+constexpr RegisterField THS_FIELDS[] =
+{
+    reg_field ("DBCNTM", 7),
+    reg_field ("THS", 0, 7)
+};
+
+constexpr RegisterField TRANSIENT_CFG_FIELDS[] =
+{
+    reg_field ("ELE", 4),
+    reg_field ("ZTEFE", 3),
+    reg_field ("YTEFE", 2),
+    reg_field ("XTEFE", 1),
+    reg_field ("HPF_BYP", 0)
+};
+
+constexpr RegisterField PULSE_CFG_FIELDS[] =
+{
+    reg_field ("DPA", 7),
+    reg_field ("ELE", 6),
+    reg_field ("ZDPEFE", 5),
+    reg_field ("ZSPEFE", 4),
+    reg_field ("YDPEFE", 3),
+    reg_field ("YSPEFE", 2),
+    reg_field ("XDPEFE", 1),
+    reg_field ("XSPEFE", 0)
+};
+
+constexpr RegisterField CTRL_REG1_FIELDS[] =
+{
+    reg_field ("ASLP_RATE", 6, 2, ASLP_NAMES),
+    reg_field ("DR", 3, 3, DR_NAMES),
+    reg_field ("LNOISE", 2),
+    reg_field ("F_READ", 1),
+    reg_field ("ACTIVE", 0)
+};
+
+constexpr RegisterField CTRL_REG2_FIELDS[] =
+{
+    reg_field ("ST", 7),
+    reg_field ("RST", 6),
+    reg_field ("SMODS", 3, 2, MODS_NAMES),
+    reg_field ("SLPE", 2),
+    reg_field ("MODS", 0, 2, MODS_NAMES)
+};
+
+constexpr RegisterField CTRL_REG3_FIELDS[] =
+{
+    reg_field ("WAKE_TRANS", 6),
+    reg_field ("WAKE_LNDPRT", 5),
+    reg_field ("WAKE_PULSE", 4),
+    reg_field ("WAKE_FF_MT", 3),
+    reg_field ("IPOL", 1),
+    reg_field ("PP_OD", 0)
+};
+
+constexpr RegisterField CTRL_REG4_FIELDS[] =
+{
+    reg_field ("INT_EN_ASLP", 7),
+    reg_field ("INT_EN_TRANS", 5),
+    reg_field ("INT_EN_LNDPRT", 4),
+    reg_field ("INT_EN_PULSE", 3),
+    reg_field ("INT_EN_FF_MT", 2),
+    reg_field ("INT_EN_DRDY", 0)
+};
+
+constexpr RegisterField CTRL_REG5_FIELDS[] =
+{
+    reg_field ("ASLP", 7, 1, PIN_NAMES),
+    reg_field ("TRANS", 5, 1, PIN_NAMES),
+    reg_field ("LNDPRT", 4, 1, PIN_NAMES),
+    reg_field ("PULSE", 3, 1, PIN_NAMES),
+    reg_field ("FF_MT", 2, 1, PIN_NAMES),
+    reg_field ("DRDY", 0, 1, PIN_NAMES)
+};
+
+
+/// Descriptions of the MMA8452Q's configuration registers, in address order
+constexpr RegisterDesc MMA8452Q_CONFIG_REGS[] =
+{
+    reg_desc ("XYZ_DATA_CFG", XYZ_DATA_CFG, XYZ_DATA_CFG_FIELDS),
+    reg_desc ("HP_FILTER_CUTOFF", HP_FILTER_CUTOFF, HP_FILTER_CUTOFF_FIELDS),
+    reg_desc ("PL_CFG", PL_CFG, PL_CFG_FIELDS),
+    reg_desc ("PL_COUNT", PL_COUNT),
+    reg_desc ("PL_BF_ZCOMP", PL_BF_ZCOMP),
+    reg_desc ("P_L_THS_REG", P_L_THS_REG),
+    reg_desc ("FF_MT_CFG", FF_MT_CFG, FF_MT_CFG_FIELDS),
+    reg_desc ("FF_MT_THS", FF_MT_THS, THS_FIELDS),
+    reg_desc ("FF_MT_COUNT", FF_MT_COUNT),
+    reg_desc ("TRANSIENT_CFG", TRANSIENT_CFG, TRANSIENT_CFG_FIELDS),
+    reg_desc ("TRANSIENT_THS", TRANSIENT_THS, THS_FIELDS),
+    reg_desc ("TRANSIENT_COUNT", TRANSIENT_COUNT),
+    reg_desc ("PULSE_CFG", PULSE_CFG, PULSE_CFG_FIELDS),
+    reg_desc ("PULSE_THSX", PULSE_THSX),
+    reg_desc ("PULSE_THSY", PULSE_THSY),
+    reg_desc ("PULSE_THSZ", PULSE_THSZ),
+    reg_desc ("PULSE_TMLT", PULSE_TMLT),
+    reg_desc ("PULSE_LTCY", PULSE_LTCY),
+    reg_desc ("PULSE_WIND", PULSE_WIND),
+    reg_desc ("ASLP_COUNT", ASLP_COUNT),
+    reg_desc ("CTRL_REG1", CTRL_REG1, CTRL_REG1_FIELDS),
+    reg_desc ("CTRL_REG2", CTRL_REG2, CTRL_REG2_FIELDS),
+    reg_desc ("CTRL_REG3", CTRL_REG3, CTRL_REG3_FIELDS),
+    reg_desc ("CTRL_REG4", CTRL_REG4, CTRL_REG4_FIELDS),
+    reg_desc ("CTRL_REG5", CTRL_REG5, CTRL_REG5_FIELDS),
+    reg_desc ("OFF_X", OFF_X),
+    reg_desc ("OFF_Y", OFF_Y),
+    reg_desc ("OFF_Z", OFF_Z)
+};
+
+/// The number of registers in @c MMA8452Q_CONFIG_REGS
+const uint8_t MMA8452Q_NUM_CONFIG_REGS = sizeof (MMA8452Q_CONFIG_REGS)
+                                         / sizeof (MMA8452Q_CONFIG_REGS[0]);
@@ -0,0 +1,23 @@
+/** @file mma8452q_registers.h
+ *    This file declares descriptions of the MMA8452Q accelerometer's
+ *    configuration registers, for use with the register decoder in
+ *    @c register_decode.h.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _MMA8452Q_REGISTERS_H_
+#define _MMA8452Q_REGISTERS_H_
+
+#include "register_decode.h"
+
+
+/// Descriptions of the MMA8452Q's configuration registers, in address order
+extern const RegisterDesc MMA8452Q_CONFIG_REGS[];
+
+/// The number of registers in @c MMA8452Q_CONFIG_REGS
+extern const uint8_t MMA8452Q_NUM_CONFIG_REGS;
+
+#endif // _MMA8452Q_REGISTERS_H_
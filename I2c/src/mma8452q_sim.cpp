@@ -0,0 +1,368 @@
+/** @file mma8452q_sim.cpp
+ *    This file contains source code for a register-level model of the
+ *    MMA8452Q accelerometer which runs against a simulated clock.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include <PrintStream.h>
+#include "SparkFun_MMA8452Q.h"
+#include "mma8452q_sim.h"
+
+
+/// Sample periods in microseconds for each @c CTRL_REG1 data rate setting
+static const uint32_t SIM_ODR_US[8] =
+    {1250, 2500, 5000, 10000, 20000, 80000, 160000, 640000};
+
+/// Bits in @c CTRL_REG1 and @c STATUS which the model uses
+const uint8_t SIM_ACTIVE = 0x01;
+const uint8_t SIM_F_READ = 0x02;
+const uint8_t SIM_ZYXDR = 0x08;
+const uint8_t SIM_ZYXOW = 0x80;
+const uint8_t SIM_RST = 0x40;
+
+
+/** @brief   Create a simulated MMA8452Q.
+ *  @param   address The I2C address to which the model answers
+ *  @param   clock_hz The simulated bus clock speed
+ */
+MMA8452QSim::MMA8452QSim (uint8_t address, uint32_t clock_hz)
+    : address (address), clock_hz (clock_hz), sim_us (0), p_trace (NULL),
+      trace_length (0), waveform (NULL)
+{
+    reset ();
+    reset_stats ();
+}
+
+
+/** @brief   Put the registers back to their power-on values.
+ *  @details The model is left in standby with all settings cleared, as after
+ *           a software reset. Simulated time and the sample count go on.
+ */
+void MMA8452QSim::reset (void)
+{
+    memset (regs, 0, sizeof (regs));
+    regs[WHO_AM_I] = 0x2A;
+    sample_count = 0;
+    next_sample_us = sim_us;
+}
+
+
+/** @brief   Play back a list of samples as the acceleration data.
+ *  @param   p_samples Samples of X, Y, and Z in thousandths of a g; the list
+ *           must last as long as the model uses it
+ *  @param   length The number of samples, which are played over and over
+ */
+void MMA8452QSim::set_trace (const int16_t (*p_samples)[3], uint16_t length)
+{
+    p_trace = p_samples;
+    trace_length = length;
+}
+
+
+/** @brief   Make the acceleration data with a function.
+ *  @details The function is only used if no trace has been set.
+ *  @param   function A function which returns the acceleration on an axis
+ */
+void MMA8452QSim::set_waveform (SimWaveform function)
+{
+    waveform = function;
+}
+
+
+/** @brief   Start the transaction and bus time counts over.
+ */
+void MMA8452QSim::reset_stats (void)
+{
+    transactions = 0;
+    bus_us = 0;
+}
+
+
+/** @brief   Let simulated time pass for one transaction.
+ *  @param   bits The number of bit times the transaction takes on the bus
+ */
+void MMA8452QSim::spend_bus_time (uint32_t bits)
+{
+    uint32_t us = (bits * 1000000UL + clock_hz - 1) / clock_hz;
+    transactions++;
+    bus_us += us;
+    advance (us);
+}
+
+
+/** @brief   Let simulated time pass without any bus traffic.
+ *  @param   us The number of microseconds which pass
+ */
+void MMA8452QSim::advance (uint32_t us)
+{
+    sim_us += us;
+    make_samples ();
+}
+
+
+/** @brief   Let simulated time pass until the next sample is ready.
+ *  @details This is what a task does when it waits for a data ready
+ *           interrupt. If a sample is already waiting, no time passes.
+ *  @returns The number of microseconds waited, or 0 if the model is in
+ *           standby and there won't be any data
+ */
+uint32_t MMA8452QSim::wait_for_data (void)
+{
+    if (!(regs[CTRL_REG1] & SIM_ACTIVE) || (regs[STATUS_MMA8452Q] & SIM_ZYXDR))
+    {
+        return 0;
+    }
+    uint32_t waited = next_sample_us - sim_us;
+    advance (waited);
+    return waited;
+}
+
+
+/** @brief   Make any samples which are due by the present simulated time.
+ *  @details Each sample is converted from thousandths of a g to 12-bit counts
+ *           at the full scale set in @c XYZ_DATA_CFG, after the offsets in
+ *           @c OFF_X, @c OFF_Y and @c OFF_Z are added, and put in the output
+ *           registers left justified, as the chip does.
+ */
+void MMA8452QSim::make_samples (void)
+{
+    if (!(regs[CTRL_REG1] & SIM_ACTIVE))
+    {
+        return;
+    }
+    uint32_t period = SIM_ODR_US[(regs[CTRL_REG1] >> 3) & 0x07];
+    uint8_t full_scale = 2 << (regs[XYZ_DATA_CFG] & 0x03);
+
+    while ((int32_t)(sim_us - next_sample_us) >= 0)
+    {
+        for (uint8_t axis = 0; axis < 3; axis++)
+        {
+            int32_t milli_g = 0;
+            if (p_trace && trace_length)
+            {
+                milli_g = p_trace[sample_count % trace_length][axis];
+            }
+            else if (waveform)
+            {
+                milli_g = waveform (sample_count, axis);
+            }
+            milli_g += 2 * (int8_t)regs[OFF_X + axis];     // 2 mg per step
+            int32_t counts = milli_g * 2048L / (full_scale * 1000L);
+            counts = constrain (counts, -2048L, 2047L);
+            regs[OUT_X_MSB + 2 * axis] = (uint8_t)(counts >> 4);
+            regs[OUT_X_LSB + 2 * axis] = (uint8_t)(counts << 4);
+        }
+        if (regs[STATUS_MMA8452Q] & SIM_ZYXDR)
+        {
+            regs[STATUS_MMA8452Q] |= SIM_ZYXOW;
+        }
+        regs[STATUS_MMA8452Q] |= SIM_ZYXDR | 0x07;
+        sample_count++;
+        next_sample_us += period;
+    }
+}
+
+
+/** @brief   Find the register which follows another in a burst.
+ *  @details Reads from the data registers wrap from @c OUT_Z back to
+ *           @c STATUS, and the LSB registers are skipped in fast-read mode,
+ *           as the chip does; elsewhere the address just goes up by one.
+ *  @param   reg The register which was just read or written
+ *  @returns The next register
+ */
+uint8_t MMA8452QSim::next_register (uint8_t reg)
+{
+    if (reg <= OUT_Z_LSB)
+    {
+        uint8_t step = ((regs[CTRL_REG1] & SIM_F_READ) && reg) ? 2 : 1;
+        return (reg + step > OUT_Z_LSB) ? STATUS_MMA8452Q : reg + step;
+    }
+    return (reg + 1U < sizeof (regs)) ? reg + 1 : STATUS_MMA8452Q;
+}
+
+
+/** @brief   Write a block of the model's registers.
+ *  @details Writes to read-only registers are ignored. While the model is
+ *           active only the @c ACTIVE bit can be changed, as on the chip.
+ *           Setting @c RST in @c CTRL_REG2 resets the model.
+ *  @param   device The I2C address being written
+ *  @param   reg The first register to be written
+ *  @param   p_data The bytes to be written
+ *  @param   length The number of bytes to write
+ *  @returns True if the model answers to @c device, false if not
+ */
+bool MMA8452QSim::write_registers (uint8_t device, uint8_t reg,
+                                   const uint8_t* p_data, uint8_t length)
+{
+    // Start, address, register, the data, and stop
+    spend_bus_time (1 + 9 + 9 + 9 * (uint32_t)length + 1);
+    if (device != address)
+    {
+        return false;
+    }
+
+    for (uint8_t index = 0; index < length; index++)
+    {
+        bool active = regs[CTRL_REG1] & SIM_ACTIVE;
+        if (reg == CTRL_REG1)
+        {
+            uint8_t mask = active ? SIM_ACTIVE : 0xFF;
+            regs[CTRL_REG1] = (regs[CTRL_REG1] & ~mask) | (p_data[index] & mask);
+            regs[SYSMOD] = regs[CTRL_REG1] & SIM_ACTIVE;
+            if (!active && (regs[CTRL_REG1] & SIM_ACTIVE))
+            {
+                next_sample_us = sim_us
+                                 + SIM_ODR_US[(regs[CTRL_REG1] >> 3) & 0x07];
+            }
+        }
+        else if (reg == CTRL_REG2 && (p_data[index] & SIM_RST))
+        {
+            reset ();
+        }
+        else if (reg >= XYZ_DATA_CFG && !active && reg != PL_STATUS
+                 && reg != FF_MT_SRC && reg != TRANSIENT_SRC && reg != PULSE_SRC)
+        {
+            regs[reg] = p_data[index];
+        }
+        reg = next_register (reg);
+    }
+    return true;
+}
+
+
+/** @brief   Read a block of the model's registers.
+ *  @details Reading @c OUT_Z clears the data ready and overwrite flags in
+ *           @c STATUS, so the next sample sets them again.
+ *  @param   device The I2C address being read
+ *  @param   reg The first register to be read
+ *  @param   p_data Where to put the bytes which are read
+ *  @param   length The number of bytes to read
+ *  @returns True if the model answers to @c device, false if not
+ */
+bool MMA8452QSim::read_registers (uint8_t device, uint8_t reg,
+                                  uint8_t* p_data, uint8_t length)
+{
+    // Start, address, register, repeated start, address, the data, and stop
+    spend_bus_time (1 + 9 + 9 + 1 + 9 + 9 * (uint32_t)length + 1);
+    if (device != address)
+    {
+        return false;
+    }
+
+    for (uint8_t index = 0; index < length; index++)
+    {
+        p_data[index] = regs[reg];
+        if (reg == OUT_Z_MSB || reg == OUT_Z_LSB)
+        {
+            regs[STATUS_MMA8452Q] = 0;
+        }
+        reg = next_register (reg);
+    }
+    return true;
+}
+
+
+/** @brief   Make a slowly rocking waveform for the benchmark.
+ *  @param   sample The sample number
+ *  @param   axis 0 for X, 1 for Y, or 2 for Z
+ *  @returns The acceleration in thousandths of a g
+ */
+static int16_t bench_waveform (uint32_t sample, uint8_t axis)
+{
+    if (axis == 2)
+    {
+        return 1000;
+    }
+    int16_t ramp = (sample * (axis + 3)) % 800;
+    return (ramp < 400) ? ramp - 200 : 600 - ramp;
+}
+
+
+/** @brief   Compare the driver's ways of reading data on a simulated sensor.
+ *  @details Each way of reading is run on a fresh model at @c ODR_800 for a
+ *           number of samples, at 100 and 400 kHz, and the transactions and
+ *           simulated bus time per sample are printed, along with the share
+ *           of the bus used and the number of samples which were overwritten
+ *           before they could be read. The ways of reading are:
+ *           * Three @c getCalculated...() calls with the frame cache off
+ *           * Polling @c available() until data is ready, then @c read()
+ *           * @c readFrame() after each data ready interrupt
+ *           * @c readFrame() in fast-read mode after each interrupt
+ *
+ *           The frame cache isn't measured here because it's timed by
+ *           @c micros() rather than the simulated clock.
+ *  @param   printer The stream such as @c Serial on which to print results
+ *  @param   samples The number of samples to read in each test
+ */
+void MMA8452Q_benchmark (Print& printer, uint16_t samples)
+{
+    const char* names[] = {"getCalculatedX/Y/Z() ", "available() poll+read()",
+                           "DRDY + readFrame()    ", "DRDY + fast readFrame()"};
+    const uint32_t clocks[] = {100000, 400000};
+
+    printer << "Simulated MMA8452Q at 800 Hz, " << samples << " samples" << endl
+            << "Pattern                 \tkHz\tTrans/sample\tBus us/sample"
+            << "\tBus %\tMissed" << endl;
+    for (uint8_t clock = 0; clock < 2; clock++)
+    {
+        for (uint8_t pattern = 0; pattern < 4; pattern++)
+        {
+            MMA8452QSim sim (MMA8452Q_DEFAULT_ADDRESS, clocks[clock]);
+            sim.set_waveform (bench_waveform);
+            MMA8452Q accel;
+            if (!accel.begin (sim))
+            {
+                printer << "The simulated sensor didn't start" << endl;
+                return;
+            }
+            accel.setFrameMaxAge (0);
+            accel.setFastRead (pattern == 3);
+
+            // Start just after a sample has been read
+            MMA8452Q_Frame frame;
+            sim.wait_for_data ();
+            accel.readFrame (frame);
+            sim.reset_stats ();
+            uint32_t start = sim.get_time_us ();
+            uint32_t made = sim.get_sample_count ();
+
+            for (uint16_t count = 0; count < samples; count++)
+            {
+                switch (pattern)
+                {
+                    case 0:
+                        sim.wait_for_data ();
+                        accel.getCalculatedX ();
+                        accel.getCalculatedY ();
+                        accel.getCalculatedZ ();
+                        break;
+                    case 1:
+                        for (uint16_t tries = 0; tries < 10000; tries++)
+                        {
+                            if (accel.available ())
+                            {
+                                break;
+                            }
+                        }
+                        accel.read ();
+                        break;
+                    default:
+                        sim.wait_for_data ();
+                        accel.readFrame (frame);
+                        break;
+                }
+            }
+
+            uint32_t elapsed = sim.get_time_us () - start;
+            made = sim.get_sample_count () - made;
+            printer << names[pattern] << '\t' << clocks[clock] / 1000 << '\t'
+                    << (float)sim.get_transactions () / samples << "\t\t"
+                    << (float)sim.get_bus_us () / samples << "\t\t"
+                    << (elapsed ? 100.0f * sim.get_bus_us () / elapsed : 0.0f)
+                    << '\t' << (made > samples ? made - samples : 0) << endl;
+        }
+    }
+}
@@ -0,0 +1,146 @@
+/** @file mma8452q_sim.h
+ *    This file contains the headers for a register-level model of the
+ *    MMA8452Q accelerometer. The model acts as an @c I2CPort, so the
+ *    @c MMA8452Q driver can be run against it with no hardware. It keeps a
+ *    simulated clock which advances by the time each transaction would take
+ *    on a real bus, produces samples at the configured data rate from a trace
+ *    or a waveform function, and counts transactions and bus time so that
+ *    the driver's ways of reading data can be compared.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _MMA8452Q_SIM_H_
+#define _MMA8452Q_SIM_H_
+
+#include <Arduino.h>
+#include "i2c_port.h"
+
+
+/// Type of a function which gives the simulated acceleration of one axis, in
+/// thousandths of a g, for a given sample number (0 for X, 1 for Y, 2 for Z)
+typedef int16_t (*SimWaveform) (uint32_t sample, uint8_t axis);
+
+
+/** @brief   Simulated MMA8452Q which is reached through the @c I2CPort API.
+ *  @details The model has the chip's register map: @c WHO_AM_I reads 0x2A,
+ *           @c SYSMOD follows the @c ACTIVE bit, @c XYZ_DATA_CFG sets the full
+ *           scale used to convert samples to counts, and @c CTRL_REG1 sets
+ *           the data rate and fast-read mode. As on the real chip, registers
+ *           other than @c CTRL_REG1's @c ACTIVE bit can only be changed in
+ *           standby, so a driver which forgets to go to standby gets caught.
+ *
+ *           While active, a new sample is made every data rate period of
+ *           simulated time; @c STATUS bit 3 (@c ZYXDR) is set when it's
+ *           ready and cleared when @c OUT_Z is read, and bit 7 (@c ZYXOW)
+ *           shows that a sample was overwritten before it was read.
+ *           Simulated time only passes during transactions and when
+ *           @c advance() or @c wait_for_data() is called:
+ *           @code
+ *           MMA8452QSim sim (0x1D, 400000);
+ *           sim.set_waveform (my_waveform);
+ *           MMA8452Q accel;
+ *           accel.begin (sim, 0x1D);
+ *           sim.reset_stats ();
+ *           sim.wait_for_data ();            // As if a DRDY interrupt came
+ *           accel.read ();
+ *           @endcode
+ */
+class MMA8452QSim : public I2CPort
+{
+protected:
+    /// The I2C address to which the model answers
+    uint8_t address;
+
+    /// The model's registers, from @c STATUS to @c OFF_Z
+    uint8_t regs[0x32];
+
+    /// The simulated bus clock speed in Hz
+    uint32_t clock_hz;
+
+    /// Simulated time in microseconds
+    uint32_t sim_us;
+
+    /// Simulated time at which the next sample will be made
+    uint32_t next_sample_us;
+
+    /// Number of samples made since the model was started
+    uint32_t sample_count;
+
+    /// Samples to be played back, in thousandths of a g, or NULL
+    const int16_t (*p_trace)[3];
+
+    /// Number of samples in @c p_trace, which is played over and over
+    uint16_t trace_length;
+
+    /// Function which makes samples if there's no trace, or NULL
+    SimWaveform waveform;
+
+    /// Number of transactions since the statistics were reset
+    uint32_t transactions;
+
+    /// Simulated bus time in microseconds since the statistics were reset
+    uint32_t bus_us;
+
+    // Let simulated time pass for one transaction
+    void spend_bus_time (uint32_t bits);
+
+    // Make any samples which are due by the present simulated time
+    void make_samples (void);
+
+    // Find the register which follows another in a burst
+    uint8_t next_register (uint8_t reg);
+
+public:
+    // Create a simulated MMA8452Q
+    MMA8452QSim (uint8_t address = 0x1D, uint32_t clock_hz = 100000);
+
+    // Put the registers back to their power-on values
+    void reset (void);
+
+    // Play back a list of samples as the acceleration data
+    void set_trace (const int16_t (*p_samples)[3], uint16_t length);
+
+    // Make the acceleration data with a function
+    void set_waveform (SimWaveform function);
+
+    // Set the simulated bus clock speed
+    void set_clock (uint32_t hz) { clock_hz = hz; }
+
+    // Let simulated time pass without any bus traffic
+    void advance (uint32_t us);
+
+    // Let simulated time pass until the next sample is ready
+    uint32_t wait_for_data (void);
+
+    // Start the transaction and bus time counts over
+    void reset_stats (void);
+
+    // Write a block of the model's registers
+    bool write_registers (uint8_t device, uint8_t reg, const uint8_t* p_data,
+                          uint8_t length);
+
+    // Read a block of the model's registers
+    bool read_registers (uint8_t device, uint8_t reg, uint8_t* p_data,
+                         uint8_t length);
+
+    /// Return the number of transactions since the statistics were reset
+    uint32_t get_transactions (void) { return transactions; }
+
+    /// Return the simulated bus time since the statistics were reset
+    uint32_t get_bus_us (void) { return bus_us; }
+
+    /// Return the number of samples made since the model was started
+    uint32_t get_sample_count (void) { return sample_count; }
+
+    /// Return the simulated time in microseconds
+    uint32_t get_time_us (void) { return sim_us; }
+};
+
+
+// Compare the driver's ways of reading data on a simulated sensor
+void MMA8452Q_benchmark (Print& printer, uint16_t samples = 200);
+
+#endif // _MMA8452Q_SIM_H_
@@ -0,0 +1,237 @@
+/** @file register_decode.cpp
+ *    This file contains source code for a facility which decodes the values
+ *    of a peripheral's registers into readable text, using constant tables
+ *    which describe each register's bit fields.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include "register_decode.h"
+
+
+/// The largest number of registers which @c print_registers() can handle
+const uint8_t MAX_REGISTERS = 64;
+
+/// The most bytes read from a device in one I2C transaction; this must not
+/// be more than the size of the @c Wire library's buffer
+const uint8_t MAX_BURST = 32;
+
+/// Hexadecimal digits, looked up by nibble
+static const char HEX_CHARS[] = "0123456789ABCDEF";
+
+
+/** @brief   Add a string to a buffer if there's room.
+ *  @param   p_out Reference to a pointer to where the string goes, which is
+ *           moved past the string
+ *  @param   p_end Pointer to the end of the buffer
+ *  @param   p_str The @c \0 terminated string to be added
+ *  @returns True if the string fit, false if not
+ */
+static bool append (char*& p_out, const char* p_end, const char* p_str)
+{
+    while (*p_str)
+    {
+        if (p_out >= p_end)
+        {
+            return false;
+        }
+        *p_out++ = *p_str++;
+    }
+    return true;
+}
+
+
+/** @brief   Add a number from 0 to 255 in decimal to a buffer if there's room.
+ *  @param   p_out Reference to a pointer to where the number goes, which is
+ *           moved past the number
+ *  @param   p_end Pointer to the end of the buffer
+ *  @param   value The number to be added
+ *  @returns True if the number fit, false if not
+ */
+static bool append_number (char*& p_out, const char* p_end, uint8_t value)
+{
+    char digits[4];
+    char* p_digit = digits + 3;
+    *p_digit = '\0';
+    do
+    {
+        *--p_digit = '0' + value % 10;
+        value /= 10;
+    }
+    while (value);
+    return append (p_out, p_end, p_digit);
+}
+
+
+/** @brief   Add a byte in two hexadecimal digits to a buffer if there's room.
+ *  @param   p_out Reference to a pointer to where the digits go, which is
+ *           moved past them
+ *  @param   p_end Pointer to the end of the buffer
+ *  @param   value The byte to be added
+ *  @returns True if the digits fit, false if not
+ */
+static bool append_hex (char*& p_out, const char* p_end, uint8_t value)
+{
+    char digits[3] = {HEX_CHARS[value >> 4], HEX_CHARS[value & 0x0F], '\0'};
+    return append (p_out, p_end, digits);
+}
+
+
+/** @brief   Decode the values of a block of registers into text.
+ *  @details Each register gets one line which shows its name, address and
+ *           raw value in hex, then each of its fields, for example
+ *           <tt>CTRL_REG1 2A=19 ASLP_RATE=50Hz DR=100Hz ... ACTIVE=1</tt>.
+ *           A register's line is only written if all of it fits, so if the
+ *           buffer fills up, the caller can print what was decoded and call
+ *           this function again for the rest of the registers.
+ *  @param   buffer The character buffer in which to write; no @c \0 is added
+ *  @param   size The size of the buffer
+ *  @param   descs An array of register descriptions
+ *  @param   count The number of registers to decode
+ *  @param   values The registers' values, in the same order as @c descs
+ *  @param   p_decoded Pointer to a place to put the number of registers
+ *           which fit in the buffer, or @c NULL if it isn't needed
+ *  @returns The number of characters written
+ */
+size_t decode_registers (char* buffer, size_t size, const RegisterDesc* descs,
+                         uint8_t count, const uint8_t* values,
+                         uint8_t* p_decoded)
+{
+    char* p_out = buffer;
+    const char* p_end = buffer + size;
+    uint8_t reg;
+
+    for (reg = 0; reg < count; reg++)
+    {
+        const RegisterDesc& desc = descs[reg];
+        uint8_t value = values[reg];
+        char* p_line = p_out;
+
+        bool fits = append (p_out, p_end, desc.name)
+                    && append (p_out, p_end, " ")
+                    && append_hex (p_out, p_end, desc.address)
+                    && append (p_out, p_end, "=")
+                    && append_hex (p_out, p_end, value);
+
+        for (uint8_t index = 0; fits && index < desc.num_fields; index++)
+        {
+            const RegisterField& field = desc.p_fields[index];
+            uint8_t field_value = (value >> field.offset)
+                                  & ((1 << field.width) - 1);
+
+            fits = append (p_out, p_end, " ")
+                   && append (p_out, p_end, field.name)
+                   && append (p_out, p_end, "=");
+            if (fits && field_value < field.num_names)
+            {
+                fits = append (p_out, p_end, field.p_names[field_value]);
+            }
+            else if (fits)
+            {
+                fits = append_number (p_out, p_end, field_value);
+            }
+        }
+
+        if (!(fits && append (p_out, p_end, "\r\n")))
+        {
+            p_out = p_line;                 // Leave out the partial line
+            break;
+        }
+    }
+
+    if (p_decoded != NULL)
+    {
+        *p_decoded = reg;
+    }
+    return p_out - buffer;
+}
+
+
+/** @brief   Read the values of a block of described registers from a device.
+ *  @details Registers at consecutive addresses are read together in one burst
+ *           transaction, so a block such as @c CTRL_REG1 through @c CTRL_REG5
+ *           costs one transaction instead of five. Only the registers which
+ *           are described are read, so registers whose flags are cleared by
+ *           reading can be left out of the descriptions.
+ *  @param   bus The I2C bus on which the device is connected
+ *  @param   device The device's I2C address
+ *  @param   descs An array of register descriptions, in order of address
+ *  @param   count The number of registers to read
+ *  @param   values An array in which to put the registers' values
+ *  @returns True if every register was read, false if the device didn't
+ *           answer with all the bytes requested
+ */
+bool read_registers (TwoWire& bus, uint8_t device, const RegisterDesc* descs,
+                     uint8_t count, uint8_t* values)
+{
+    uint8_t first = 0;
+    while (first < count)
+    {
+        // Find how many registers from here on have consecutive addresses
+        uint8_t length = 1;
+        while (first + length < count && length < MAX_BURST
+               && descs[first + length].address
+                  == descs[first].address + length)
+        {
+            length++;
+        }
+
+        bus.beginTransmission (device);
+        bus.write (descs[first].address);
+        bus.endTransmission (false);
+        if (bus.requestFrom (device, length) != length)
+        {
+            return false;
+        }
+        for (uint8_t index = 0; index < length; index++)
+        {
+            values[first + index] = bus.read ();
+        }
+
+        first += length;
+    }
+    return true;
+}
+
+
+/** @brief   Read, decode and print a block of described registers.
+ *  @details The registers are read with @c read_registers(), decoded into a
+ *           buffer on the stack, and printed with as few writes as the
+ *           buffer size allows.
+ *  @param   printer The serial device, such as @c Serial, on which to print
+ *  @param   bus The I2C bus on which the device is connected
+ *  @param   device The device's I2C address
+ *  @param   descs An array of register descriptions, in order of address
+ *  @param   count The number of registers, at most @c MAX_REGISTERS
+ *  @returns True if the registers were read and printed, false if not
+ */
+bool print_registers (Print& printer, TwoWire& bus, uint8_t device,
+                      const RegisterDesc* descs, uint8_t count)
+{
+    uint8_t values[MAX_REGISTERS];
+    char buffer[256];
+
+    if (count > MAX_REGISTERS
+        || !read_registers (bus, device, descs, count, values))
+    {
+        return false;
+    }
+
+    uint8_t done = 0;
+    while (done < count)
+    {
+        uint8_t decoded;
+        size_t length = decode_registers (buffer, sizeof (buffer),
+                                          descs + done, count - done,
+                                          values + done, &decoded);
+        if (decoded == 0)
+        {
+            return false;                   // One line is too big to print
+        }
+        printer.write ((const uint8_t*)buffer, length);
+        done += decoded;
+    }
+    return true;
+}
@@ -0,0 +1,110 @@
+/** @file register_decode.h
+ *    This file contains the headers for a facility which turns the raw values
+ *    of a peripheral's registers into readable text. Each register is
+ *    described by a constant table of bit fields, with names for fields whose
+ *    values mean something other than a number. The descriptions are
+ *    @c constexpr data, so they live in flash and use no RAM.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _REGISTER_DECODE_H_
+#define _REGISTER_DECODE_H_
+
+#include <Arduino.h>
+#include <Wire.h>
+
+
+/** @brief   Description of one bit field within a register.
+ *  @details If @c p_names isn't @c NULL, it points to an array of
+ *           @c num_names strings, and field values less than @c num_names
+ *           are printed as the string with that index.
+ */
+struct RegisterField
+{
+    const char* name;                 ///< Name of the field
+    uint8_t offset;                   ///< Bit number of the field's LSB
+    uint8_t width;                    ///< Number of bits in the field
+    const char* const* p_names;       ///< Names of the field's values or NULL
+    uint8_t num_names;                ///< Number of names in @c p_names
+};
+
+
+/** @brief   Description of one 8-bit register.
+ *  @details A register with no fields is printed as its raw value only.
+ */
+struct RegisterDesc
+{
+    const char* name;                 ///< Name of the register
+    uint8_t address;                  ///< Address of the register
+    const RegisterField* p_fields;    ///< Fields from the MSB down, or NULL
+    uint8_t num_fields;               ///< Number of fields in @c p_fields
+};
+
+
+/** @brief   Make a description of a field whose value is just a number.
+ *  @param   name The name of the field
+ *  @param   offset The bit number of the field's least significant bit
+ *  @param   width The number of bits in the field
+ */
+constexpr RegisterField reg_field (const char* name, uint8_t offset,
+                                   uint8_t width = 1)
+{
+    return RegisterField {name, offset, width, NULL, 0};
+}
+
+
+/** @brief   Make a description of a field whose values have names.
+ *  @param   name The name of the field
+ *  @param   offset The bit number of the field's least significant bit
+ *  @param   width The number of bits in the field
+ *  @param   names An array with a name for each value of the field
+ */
+template <uint8_t N>
+constexpr RegisterField reg_field (const char* name, uint8_t offset,
+                                   uint8_t width,
+                                   const char* const (&names)[N])
+{
+    return RegisterField {name, offset, width, names, N};
+}
+
+
+/** @brief   Make a description of a register from an array of its fields.
+ *  @param   name The name of the register
+ *  @param   address The address of the register
+ *  @param   fields An array of descriptions of the register's fields
+ */
+template <uint8_t N>
+constexpr RegisterDesc reg_desc (const char* name, uint8_t address,
+                                 const RegisterField (&fields)[N])
+{
+    return RegisterDesc {name, address, fields, N};
+}
+
+
+/** @brief   Make a description of a register which has no separate fields.
+ *  @param   name The name of the register
+ *  @param   address The address of the register
+ */
+constexpr RegisterDesc reg_desc (const char* name, uint8_t address)
+{
+    return RegisterDesc {name, address, NULL, 0};
+}
+
+
+// Decode the values of a block of registers into text
+size_t decode_registers (char* buffer, size_t size, const RegisterDesc* descs,
+                         uint8_t count, const uint8_t* values,
+                         uint8_t* p_decoded = NULL);
+
+// Read the values of a block of described registers from an I2C device
+bool read_registers (TwoWire& bus, uint8_t device, const RegisterDesc* descs,
+                     uint8_t count, uint8_t* values);
+
+// Read, decode and print a block of described registers
+bool print_registers (Print& printer, TwoWire& bus, uint8_t device,
+                      const RegisterDesc* descs, uint8_t count);
+
+#endif // _REGISTER_DECODE_H_
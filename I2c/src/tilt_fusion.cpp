@@ -0,0 +1,344 @@
+/** @file tilt_fusion.cpp
+ *    This file contains source code for a class which estimates pitch and roll
+ *    angles from an accelerometer and, if available, a gyroscope, using
+ *    either a complementary filter or an extended Kalman filter.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include "tilt_fusion.h"
+
+
+/// Accelerometer readings whose squared magnitude in g^2 is outside this
+/// range are not used to correct the angles
+const float MIN_GRAVITY_SQ = 0.25f;
+const float MAX_GRAVITY_SQ = 2.25f;
+
+/// The initial variance of each angle, in rad^2, before any updates
+const float INITIAL_VARIANCE = 0.1f;
+
+/// Pi as a @c float ; Arduino's @c PI is a @c double , and mixing it in
+/// would make the chip do the arithmetic in slow software doubles
+const float PI_F = 3.14159265f;
+
+
+/** @brief   Wrap an angle difference into the range -pi to pi.
+ *  @param   angle The angle in radians
+ *  @returns The same angle, plus or minus a multiple of 2 pi
+ */
+static float wrap_pi (float angle)
+{
+    if (angle > PI_F)
+    {
+        angle -= 2.0f * PI_F;
+    }
+    else if (angle < -PI_F)
+    {
+        angle += 2.0f * PI_F;
+    }
+    return angle;
+}
+
+
+/** @brief   Create a tilt estimator.
+ *  @param   fusion_mode Which method to use, @c FUSION_COMPLEMENTARY or
+ *           @c FUSION_EKF
+ *  @param   comp_alpha The complementary filter's weight on the integrated
+ *           gyro angle each step, between 0 and 1; values near 1 trust the
+ *           gyro more
+ *  @param   ekf_q The EKF's process noise in rad^2/s; larger values let the
+ *           accelerometer pull the angles around more quickly
+ *  @param   ekf_r The EKF's variance of each normalized gravity component
+ */
+TiltFusion::TiltFusion (TiltFusionMode fusion_mode, float comp_alpha,
+                        float ekf_q, float ekf_r)
+{
+    mode = fusion_mode;
+    alpha = comp_alpha;
+    q_angle = ekf_q;
+    r_accel = ekf_r;
+    reset ();
+}
+
+
+/** @brief   Forget the current estimate.
+ *  @details The next accelerometer reading will be taken as the starting
+ *           angles, and the covariance is set back to its initial value.
+ */
+void TiltFusion::reset (void)
+{
+    roll = 0.0f;
+    pitch = 0.0f;
+    P[0][0] = INITIAL_VARIANCE;
+    P[0][1] = 0.0f;
+    P[1][0] = 0.0f;
+    P[1][1] = INITIAL_VARIANCE;
+    started = false;
+}
+
+
+/** @brief   Run one time step using accelerometer readings only.
+ *  @details With no gyro, the EKF assumes the angles stay still between steps
+ *           and the complementary filter acts as a low-pass filter on the
+ *           angles measured from gravity.
+ *  @param   ax The acceleration along the sensor's X axis in g
+ *  @param   ay The acceleration along the sensor's Y axis in g
+ *  @param   az The acceleration along the sensor's Z axis in g
+ *  @param   dt The time since the previous update in seconds
+ */
+void TiltFusion::update (float ax, float ay, float az, float dt)
+{
+    predict (0.0f, 0.0f, 0.0f, dt);
+    correct (ax, ay, az, dt);
+}
+
+
+/** @brief   Run one time step using accelerometer and gyro readings.
+ *  @param   ax The acceleration along the sensor's X axis in g
+ *  @param   ay The acceleration along the sensor's Y axis in g
+ *  @param   az The acceleration along the sensor's Z axis in g
+ *  @param   gx The rotation rate about the sensor's X axis in rad/s
+ *  @param   gy The rotation rate about the sensor's Y axis in rad/s
+ *  @param   gz The rotation rate about the sensor's Z axis in rad/s
+ *  @param   dt The time since the previous update in seconds
+ */
+void TiltFusion::update (float ax, float ay, float az, float gx, float gy,
+                         float gz, float dt)
+{
+    predict (gx, gy, gz, dt);
+    correct (ax, ay, az, dt);
+}
+
+
+/** @brief   Run one time step using the readings from an MMA8452Q.
+ *  @details This method uses the calculated accelerations @c cx, @c cy and
+ *           @c cz which were saved by the most recent call to the
+ *           accelerometer's @c read() method; it does not talk to the sensor.
+ *  @param   accel The accelerometer, which must have just been read
+ *  @param   dt The time since the previous update in seconds
+ */
+void TiltFusion::update (MMA8452Q& accel, float dt)
+{
+    update (accel.cx, accel.cy, accel.cz, dt);
+}
+
+
+/** @brief   Propagate the angles forward in time using gyro rates.
+ *  @details The body rates are converted to Euler angle rates and integrated.
+ *           In EKF mode the covariance is propagated through the Jacobian of
+ *           that step, and process noise is added.
+ *  @param   gx The rotation rate about the sensor's X axis in rad/s
+ *  @param   gy The rotation rate about the sensor's Y axis in rad/s
+ *  @param   gz The rotation rate about the sensor's Z axis in rad/s
+ *  @param   dt The time step in seconds
+ */
+void TiltFusion::predict (float gx, float gy, float gz, float dt)
+{
+    if (!started)
+    {
+        return;
+    }
+
+    float sin_r = sinf (roll);
+    float cos_r = cosf (roll);
+    float cos_p = cosf (pitch);
+    float tan_p = tanf (pitch);
+
+    float roll_rate = gx + (gy * sin_r + gz * cos_r) * tan_p;
+    float pitch_rate = gy * cos_r - gz * sin_r;
+
+    if (mode == FUSION_EKF)
+    {
+        // Jacobian of the Euler angle step with respect to [roll, pitch]
+        float F00 = 1.0f + dt * (gy * cos_r - gz * sin_r) * tan_p;
+        float F01 = dt * (gy * sin_r + gz * cos_r) / (cos_p * cos_p);
+        float F10 = -dt * (gy * sin_r + gz * cos_r);
+
+        // P = F P F' + Q, where the second row of F is [F10, 1]
+        float A00 = F00 * P[0][0] + F01 * P[1][0];
+        float A01 = F00 * P[0][1] + F01 * P[1][1];
+        float A10 = F10 * P[0][0] + P[1][0];
+        float A11 = F10 * P[0][1] + P[1][1];
+
+        P[0][0] = A00 * F00 + A01 * F01 + q_angle * dt;
+        P[0][1] = A00 * F10 + A01;
+        P[1][0] = P[0][1];
+        P[1][1] = A10 * F10 + A11 + q_angle * dt;
+    }
+
+    roll = wrap_pi (roll + roll_rate * dt);
+    pitch += pitch_rate * dt;
+}
+
+
+/** @brief   Correct the angles with a measurement of the direction of gravity.
+ *  @details The complementary filter blends in the angles computed directly
+ *           from the accelerometer. The EKF compares the normalized gravity
+ *           vector with the one predicted from the current angles,
+ *           [-sin(pitch), sin(roll) cos(pitch), cos(roll) cos(pitch)], and
+ *           applies a Kalman gain computed from the 3 by 3 innovation
+ *           covariance.
+ *  @param   ax The acceleration along the sensor's X axis in g
+ *  @param   ay The acceleration along the sensor's Y axis in g
+ *  @param   az The acceleration along the sensor's Z axis in g
+ *  @param   dt The time step in seconds
+ */
+void TiltFusion::correct (float ax, float ay, float az, float dt)
+{
+    (void)dt;
+
+    // Skip readings which are dominated by motion rather than gravity
+    float mag_sq = ax * ax + ay * ay + az * az;
+    if (mag_sq < MIN_GRAVITY_SQ || mag_sq > MAX_GRAVITY_SQ)
+    {
+        return;
+    }
+
+    float accel_roll = atan2f (ay, az);
+    float accel_pitch = atan2f (-ax, sqrtf (ay * ay + az * az));
+
+    // The first usable reading sets the angles directly
+    if (!started)
+    {
+        roll = accel_roll;
+        pitch = accel_pitch;
+        started = true;
+        return;
+    }
+
+    if (mode == FUSION_COMPLEMENTARY)
+    {
+        roll = wrap_pi (roll + (1.0f - alpha) * wrap_pi (accel_roll - roll));
+        pitch += (1.0f - alpha) * (accel_pitch - pitch);
+        return;
+    }
+
+    // Normalized measurement and its prediction from the current angles
+    float inv_mag = 1.0f / sqrtf (mag_sq);
+    float sin_r = sinf (roll);
+    float cos_r = cosf (roll);
+    float sin_p = sinf (pitch);
+    float cos_p = cosf (pitch);
+
+    float y[3];                                // Innovation z - h(x)
+    y[0] = ax * inv_mag + sin_p;
+    y[1] = ay * inv_mag - sin_r * cos_p;
+    y[2] = az * inv_mag - cos_r * cos_p;
+
+    // Measurement Jacobian H, 3 rows by 2 columns
+    float H[3][2] = {{0.0f,           -cos_p},
+                     {cos_r * cos_p,  -sin_r * sin_p},
+                     {-sin_r * cos_p, -cos_r * sin_p}};
+
+    // PHt = P H', 2 by 3
+    float PHt[2][3];
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        for (uint8_t j = 0; j < 3; j++)
+        {
+            PHt[i][j] = P[i][0] * H[j][0] + P[i][1] * H[j][1];
+        }
+    }
+
+    // S = H P H' + R, 3 by 3 and symmetric
+    float S[3][3];
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        for (uint8_t j = 0; j < 3; j++)
+        {
+            S[i][j] = H[i][0] * PHt[0][j] + H[i][1] * PHt[1][j];
+        }
+        S[i][i] += r_accel;
+    }
+
+    // Invert S by its adjugate
+    float C00 = S[1][1] * S[2][2] - S[1][2] * S[2][1];
+    float C01 = S[1][2] * S[2][0] - S[1][0] * S[2][2];
+    float C02 = S[1][0] * S[2][1] - S[1][1] * S[2][0];
+    float det = S[0][0] * C00 + S[0][1] * C01 + S[0][2] * C02;
+    if (fabsf (det) < 1e-12f)
+    {
+        return;
+    }
+    float inv_det = 1.0f / det;
+    float Si[3][3];
+    Si[0][0] = C00 * inv_det;
+    Si[1][0] = C01 * inv_det;
+    Si[2][0] = C02 * inv_det;
+    Si[0][1] = (S[0][2] * S[2][1] - S[0][1] * S[2][2]) * inv_det;
+    Si[1][1] = (S[0][0] * S[2][2] - S[0][2] * S[2][0]) * inv_det;
+    Si[2][1] = (S[0][1] * S[2][0] - S[0][0] * S[2][1]) * inv_det;
+    Si[0][2] = (S[0][1] * S[1][2] - S[0][2] * S[1][1]) * inv_det;
+    Si[1][2] = (S[0][2] * S[1][0] - S[0][0] * S[1][2]) * inv_det;
+    Si[2][2] = (S[0][0] * S[1][1] - S[0][1] * S[1][0]) * inv_det;
+
+    // Kalman gain K = P H' S^-1, 2 by 3, and the state correction K y
+    float K[2][3];
+    float dx[2] = {0.0f, 0.0f};
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        for (uint8_t j = 0; j < 3; j++)
+        {
+            K[i][j] = PHt[i][0] * Si[0][j] + PHt[i][1] * Si[1][j]
+                      + PHt[i][2] * Si[2][j];
+            dx[i] += K[i][j] * y[j];
+        }
+    }
+    roll = wrap_pi (roll + dx[0]);
+    pitch += dx[1];
+
+    // P = (I - K H) P
+    float KH[2][2];
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        for (uint8_t j = 0; j < 2; j++)
+        {
+            KH[i][j] = K[i][0] * H[0][j] + K[i][1] * H[1][j]
+                       + K[i][2] * H[2][j];
+        }
+    }
+    float P00 = (1.0f - KH[0][0]) * P[0][0] - KH[0][1] * P[1][0];
+    float P01 = (1.0f - KH[0][0]) * P[0][1] - KH[0][1] * P[1][1];
+    float P11 = -KH[1][0] * P[0][1] + (1.0f - KH[1][1]) * P[1][1];
+    P[0][0] = P00;
+    P[0][1] = P01;
+    P[1][0] = P01;
+    P[1][1] = P11;
+}
+
+
+/** @brief   Get the current attitude as a unit quaternion.
+ *  @details The quaternion is computed from the roll and pitch angles with a
+ *           heading (yaw) of zero, since gravity says nothing about heading.
+ *  @param   p_quat Pointer to an array of four floats which will be filled
+ *           with the quaternion in the order w, x, y, z
+ */
+void TiltFusion::get_quaternion (float* p_quat)
+{
+    float sin_r = sinf (roll * 0.5f);
+    float cos_r = cosf (roll * 0.5f);
+    float sin_p = sinf (pitch * 0.5f);
+    float cos_p = cosf (pitch * 0.5f);
+
+    p_quat[0] = cos_r * cos_p;
+    p_quat[1] = sin_r * cos_p;
+    p_quat[2] = cos_r * sin_p;
+    p_quat[3] = -sin_r * sin_p;
+}
+
+
+/** @brief   Get the error covariance of the angle estimates.
+ *  @details The covariance is only kept in EKF mode; in complementary mode
+ *           its initial value is returned.
+ *  @param   p_cov Pointer to an array of four floats which will be filled with
+ *           the covariance of [roll, pitch] in row order, in rad^2
+ */
+void TiltFusion::get_covariance (float* p_cov)
+{
+    p_cov[0] = P[0][0];
+    p_cov[1] = P[0][1];
+    p_cov[2] = P[1][0];
+    p_cov[3] = P[1][1];
+}
@@ -0,0 +1,123 @@
+/** @file tilt_fusion.h
+ *    This file contains the headers for a class which turns accelerometer
+ *    readings, and gyroscope readings if a gyro is available, into pitch and
+ *    roll angles. Either a complementary filter or an extended Kalman filter
+ *    may be used. All the math is done in single precision with fixed-size
+ *    member arrays, so nothing is allocated while the filter runs.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _TILT_FUSION_H_
+#define _TILT_FUSION_H_
+
+#include <Arduino.h>
+#include "SparkFun_MMA8452Q.h"
+
+
+/// The methods which can be used to combine sensor readings into angles
+enum TiltFusionMode
+{
+    FUSION_COMPLEMENTARY,           ///< Blend gyro integral with accel angles
+    FUSION_EKF                      ///< Extended Kalman filter on pitch, roll
+};
+
+
+/** @brief   Class which estimates pitch and roll from an accelerometer and an
+ *           optional gyroscope.
+ *  @details Angles are in radians, using the aerospace convention in which
+ *           roll turns about the X axis and then pitch about the Y axis. The
+ *           accelerometer readings are in units of g and the gyro readings in
+ *           radians per second, each given in the sensor's own axes.
+ *
+ *           In complementary mode, the gyro rates are integrated and the
+ *           result is pulled slowly toward the angles measured from gravity;
+ *           if there is no gyro, the accelerometer angles are simply low-pass
+ *           filtered. In EKF mode a two-state extended Kalman filter predicts
+ *           with the gyro rates and corrects with the direction of gravity,
+ *           and an estimate of the angles' error covariance is kept. In either
+ *           mode, accelerometer readings whose magnitude is far from 1 g are
+ *           ignored because they mostly measure motion rather than tilt.
+ *
+ *           A typical use with an MMA8452Q looks like this:
+ *           @code
+ *           TiltFusion tilt (FUSION_EKF);
+ *           ...
+ *           accel.read ();
+ *           tilt.update (accel, 0.00125);          // 800 Hz data rate
+ *           Serial << tilt.get_pitch () << "," << tilt.get_roll () << endl;
+ *           @endcode
+ */
+class TiltFusion
+{
+protected:
+    /// Which fusion method is in use
+    TiltFusionMode mode;
+
+    /// The roll angle estimate in radians
+    float roll;
+
+    /// The pitch angle estimate in radians
+    float pitch;
+
+    /// The complementary filter's weight on the integrated gyro angle
+    float alpha;
+
+    /// The EKF's process noise spectral density in rad^2/s
+    float q_angle;
+
+    /// The EKF's measurement noise variance for each gravity component, g^2
+    float r_accel;
+
+    /// The EKF's error covariance of [roll, pitch], in rad^2
+    float P[2][2];
+
+    /// True once the angles have been set from a first accelerometer reading
+    bool started;
+
+    // Correct the angles with a measurement of gravity
+    void correct (float ax, float ay, float az, float dt);
+
+    // Propagate the angles and covariance using the gyro rates
+    void predict (float gx, float gy, float gz, float dt);
+
+public:
+    // Constructor which chooses the fusion method and its tuning
+    TiltFusion (TiltFusionMode fusion_mode = FUSION_COMPLEMENTARY,
+                float comp_alpha = 0.98, float ekf_q = 0.001,
+                float ekf_r = 0.03);
+
+    // Run one time step with accelerometer readings only
+    void update (float ax, float ay, float az, float dt);
+
+    // Run one time step with accelerometer and gyro readings
+    void update (float ax, float ay, float az, float gx, float gy, float gz,
+                 float dt);
+
+    // Run one time step with the values from the most recent MMA8452Q::read()
+    void update (MMA8452Q& accel, float dt);
+
+    void reset (void);                         // Start over at next reading
+    void get_quaternion (float* p_quat);       // Get attitude as quaternion
+    void get_covariance (float* p_cov);        // Get EKF covariance matrix
+
+    /** @brief   Get the most recent estimate of the roll angle.
+     *  @returns The roll angle in radians
+     */
+    float get_roll (void)
+    {
+        return roll;
+    }
+
+    /** @brief   Get the most recent estimate of the pitch angle.
+     *  @returns The pitch angle in radians
+     */
+    float get_pitch (void)
+    {
+        return pitch;
+    }
+};
+
+#endif // _TILT_FUSION_H_
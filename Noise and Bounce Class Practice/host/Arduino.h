@@ -0,0 +1,87 @@
+/** @file Arduino.h
+ *    This file stands in for the Arduino core when the debouncers and the
+ *    gesture engine are built on a PC for testing. Only the parts of the
+ *    core which they use are here: @c Print, the GPIO port type, and the
+ *    clock, which the tests set themselves.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/// A GPIO port; only its input register is used
+struct GPIO_TypeDef
+{
+    volatile uint32_t IDR;            ///< The input data register
+};
+
+
+/// The time returned by @c micros(), which a test moves along itself
+extern uint32_t host_micros;
+
+/** @brief   Return the time which the test has set, in microseconds.
+ */
+inline uint32_t micros (void)
+{
+    return host_micros;
+}
+
+
+/** @brief   A device to which text can be printed, as in the Arduino core.
+ */
+class Print
+{
+public:
+    /// Write one character; this is what descendents must provide
+    virtual size_t write (uint8_t character) = 0;
+
+    size_t print (const char* p_text)
+    {
+        size_t count = 0;
+        while (*p_text)
+        {
+            count += write ((uint8_t)*p_text++);
+        }
+        return count;
+    }
+    size_t print (char character) { return write ((uint8_t)character); }
+    size_t print (long number)
+    {
+        char text[24];
+        snprintf (text, sizeof (text), "%ld", number);
+        return print (text);
+    }
+    size_t print (unsigned long number)
+    {
+        char text[24];
+        snprintf (text, sizeof (text), "%lu", number);
+        return print (text);
+    }
+    size_t print (int number) { return print ((long)number); }
+    size_t print (unsigned int number) { return print ((unsigned long)number); }
+    size_t println (const char* p_text) { return print (p_text) + print ('\n'); }
+
+    /// Print with a format, as the ESP32 and STM32 cores can
+    size_t printf (const char* format, ...)
+        __attribute__ ((format (printf, 2, 3)))
+    {
+        char text[128];
+        va_list args;
+        va_start (args, format);
+        vsnprintf (text, sizeof (text), format, args);
+        va_end (args);
+        return print (text);
+    }
+};
+
+#endif // _HOST_ARDUINO_H_
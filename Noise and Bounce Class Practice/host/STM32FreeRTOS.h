@@ -0,0 +1,9 @@
+/** @file STM32FreeRTOS.h
+ *    This file stands in for the STM32 FreeRTOS library on a PC; see
+ *    @c FreeRTOS.h in this directory.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include "FreeRTOS.h"
@@ -0,0 +1,256 @@
+/** @file test_gestures.cpp
+ *    This file tests the port debouncer and the gesture engine together on a
+ *    PC. Bouncy button traces are replayed one sample per millisecond, as
+ *    the button task would read them, through a @c PortDebouncer and into a
+ *    @c GestureEngine ; the gestures which come out are checked against the
+ *    ones which a person pressing the button meant to make. Each trace is
+ *    replayed once at an ordinary time and once across the moment when
+ *    @c micros() wraps around, which must make no difference. To build and
+ *    run the tests, from the @c "Noise and Bounce Class Practice" directory:
+ *    @code
+ *    g++ -O2 -I host -o test_gestures host/test_gestures.cpp \
+ *        src/button_gestures.cpp src/port_debouncer.cpp src/baseshare.cpp
+ *    ./test_gestures
+ *    @endcode
+ *    It prints each test's result and returns 0 if they all passed.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include "../src/port_debouncer.h"
+#include "../src/button_gestures.h"
+
+
+/// The time returned by @c micros()
+uint32_t host_micros = 0;
+
+/// Queue which carries gestures out of the engine
+Queue<GestureEvent> gestures (32, "Gestures");
+
+/// Timing for every test: long press 600 ms, double click 300 ms
+const GestureConfig TIMING = {600, 300};
+
+/// Time at which a replay starts so that @c micros() wraps 200 ms into it
+const uint32_t NEAR_WRAP = 0xFFFFFFFFUL - 200000UL;
+
+/// Most gestures which a test expects
+const uint8_t MAX_GESTURES = 12;
+
+
+/// A stretch of a trace during which an input reads one level
+struct TraceRun
+{
+    uint32_t level;                   ///< What the inputs read, one per bit
+    uint16_t ms;                      ///< For how many milliseconds
+};
+
+
+/// A click whose press and release both bounce for a few milliseconds
+const TraceRun CLICK[] =
+{
+    {0, 20}, {1, 1}, {0, 1}, {1, 2}, {0, 1}, {1, 1}, {0, 1}, {1, 90},
+    {0, 1}, {1, 2}, {0, 2}, {1, 1}, {0, 500}
+};
+
+/// Two bouncy clicks 150 ms apart
+const TraceRun DOUBLE_CLICK[] =
+{
+    {0, 20}, {1, 1}, {0, 2}, {1, 80}, {0, 1}, {1, 1}, {0, 150},
+    {1, 2}, {0, 1}, {1, 1}, {0, 1}, {1, 70}, {0, 2}, {1, 1}, {0, 500}
+};
+
+/// A bouncy press held for a second
+const TraceRun LONG_PRESS[] =
+{
+    {0, 20}, {1, 1}, {0, 1}, {1, 3}, {0, 2}, {1, 1000},
+    {0, 1}, {1, 1}, {0, 300}
+};
+
+/// Glitches too short to be presses, such as from a nearby motor
+const TraceRun GLITCHES[] =
+{
+    {0, 20}, {1, 3}, {0, 40}, {1, 1}, {0, 1}, {1, 2}, {0, 60},
+    {1, 3}, {0, 500}
+};
+
+/// A click on button 0 during a long press on button 1
+const TraceRun TWO_BUTTONS[] =
+{
+    {0, 20}, {2, 1}, {0, 1}, {2, 100}, {3, 2}, {2, 1}, {3, 80},
+    {2, 1}, {3, 1}, {2, 900}, {0, 1}, {2, 1}, {0, 500}
+};
+
+
+/// A gesture which a test expects, found on one button
+struct Expected
+{
+    uint8_t button;                   ///< Which button
+    GestureType type;                 ///< Which gesture
+};
+
+
+/** @brief   Replay a trace and return the gestures which came out.
+ *  @param   p_trace The trace
+ *  @param   runs The number of runs in the trace
+ *  @param   start The time at which the replay starts, in microseconds
+ *  @param   p_out An array into which the gestures are copied
+ *  @param   p_dropped Set to the number of gestures the engine dropped
+ *  @returns The number of gestures in the queue after the replay
+ */
+static uint8_t replay (const TraceRun* p_trace, uint8_t runs, uint32_t start,
+                       GestureEvent* p_out, uint16_t* p_dropped)
+{
+    GestureState states[2];
+    GestureEngine engine (states, 2, gestures, TIMING);
+    PortDebouncer debouncer (NULL, 0x03, 0);
+
+    host_micros = start;
+    for (uint8_t run = 0; run < runs; run++)
+    {
+        for (uint16_t ms = 0; ms < p_trace[run].ms; ms++)
+        {
+            debouncer.update (p_trace[run].level);
+            for (uint8_t button = 0; button < 2; button++)
+            {
+                if (debouncer.get_changed () & (1 << button))
+                {
+                    ButtonEvent event;
+                    event.time = micros ();
+                    event.button = button;
+                    event.type = (debouncer.get_rising () & (1 << button))
+                                 ? BUTTON_PRESS : BUTTON_RELEASE;
+                    engine.edge (event);
+                }
+            }
+            engine.tick (micros ());
+            host_micros += 1000;
+        }
+    }
+
+    *p_dropped = engine.get_dropped ();
+    uint8_t count = 0;
+    while (count < MAX_GESTURES && gestures.any ())
+    {
+        gestures.get (p_out[count++]);
+    }
+    while (gestures.any ())
+    {
+        GestureEvent extra;
+        gestures.get (extra);
+        count++;
+    }
+    return count;
+}
+
+
+/** @brief   Replay a trace at two times and check its gestures.
+ *  @param   name The name of the test, which is printed
+ *  @param   p_trace The trace
+ *  @param   runs The number of runs in the trace
+ *  @param   p_expected The gestures which should come out, in order
+ *  @param   expected_count The number of gestures which should come out
+ *  @returns True if the test passed, false if not
+ */
+static bool check (const char* name, const TraceRun* p_trace, uint8_t runs,
+                   const Expected* p_expected, uint8_t expected_count)
+{
+    const uint32_t starts[] = {1000000UL, NEAR_WRAP};
+    bool passed = true;
+    for (uint8_t which = 0; which < 2; which++)
+    {
+        GestureEvent got[MAX_GESTURES];
+        uint16_t dropped = 0;
+        uint8_t count = replay (p_trace, runs, starts[which], got, &dropped);
+        bool same = (count == expected_count && dropped == 0);
+        for (uint8_t index = 0; same && index < count; index++)
+        {
+            same = (got[index].button == p_expected[index].button
+                    && got[index].type == p_expected[index].type);
+        }
+        if (!same)
+        {
+            printf ("FAIL %s starting at %lu us: got", name,
+                    (unsigned long)starts[which]);
+            for (uint8_t index = 0; index < count && index < MAX_GESTURES;
+                 index++)
+            {
+                printf (" %u:%u", got[index].button, got[index].type);
+            }
+            printf (" (%u dropped)\n", dropped);
+            passed = false;
+        }
+    }
+    if (passed)
+    {
+        printf ("pass %s\n", name);
+    }
+    return passed;
+}
+
+
+/** @brief   Check that a full queue makes the engine drop gestures rather
+ *           than wait for room.
+ *  @returns True if the test passed, false if not
+ */
+static bool check_full_queue (void)
+{
+    Queue<GestureEvent> tiny (2, "Tiny");
+    GestureState state;
+    GestureEngine engine (&state, 1, tiny, TIMING);
+
+    ButtonEvent event = {1000, 0, BUTTON_PRESS};
+    engine.edge (event);                        // Press
+    event.type = BUTTON_RELEASE;
+    engine.edge (event);                        // Release
+    event.type = BUTTON_PRESS;
+    engine.edge (event);                        // Press and double click
+
+    bool passed = (tiny.available () == 2 && engine.get_dropped () == 2);
+    printf ("%s full queue: %u queued, %u dropped\n", passed ? "pass" : "FAIL",
+            (unsigned)tiny.available (), engine.get_dropped ());
+    return passed;
+}
+
+
+/// Shorthand for the number of items in an array
+#define COUNT_OF(array) (sizeof (array) / sizeof ((array)[0]))
+
+
+/** @brief   Run every test.
+ *  @returns 0 if every test passed, 1 if any failed
+ */
+int main (void)
+{
+    const Expected click[] =
+    {
+        {0, GESTURE_PRESS}, {0, GESTURE_RELEASE}, {0, GESTURE_CLICK}
+    };
+    const Expected double_click[] =
+    {
+        {0, GESTURE_PRESS}, {0, GESTURE_RELEASE}, {0, GESTURE_PRESS},
+        {0, GESTURE_DOUBLE_CLICK}, {0, GESTURE_RELEASE}
+    };
+    const Expected long_press[] =
+    {
+        {0, GESTURE_PRESS}, {0, GESTURE_LONG_PRESS}, {0, GESTURE_RELEASE}
+    };
+    const Expected two_buttons[] =
+    {
+        {1, GESTURE_PRESS}, {0, GESTURE_PRESS}, {0, GESTURE_RELEASE},
+        {0, GESTURE_CLICK}, {1, GESTURE_LONG_PRESS}, {1, GESTURE_RELEASE}
+    };
+
+    bool passed = check ("click", CLICK, COUNT_OF (CLICK), click,
+                         COUNT_OF (click));
+    passed &= check ("double click", DOUBLE_CLICK, COUNT_OF (DOUBLE_CLICK),
+                     double_click, COUNT_OF (double_click));
+    passed &= check ("long press", LONG_PRESS, COUNT_OF (LONG_PRESS),
+                     long_press, COUNT_OF (long_press));
+    passed &= check ("glitches", GLITCHES, COUNT_OF (GLITCHES), NULL, 0);
+    passed &= check ("two buttons", TWO_BUTTONS, COUNT_OF (TWO_BUTTONS),
+                     two_buttons, COUNT_OF (two_buttons));
+    passed &= check_full_queue ();
+    return passed ? 0 : 1;
+}
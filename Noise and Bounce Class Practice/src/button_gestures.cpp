@@ -0,0 +1,192 @@
+/** @file button_gestures.cpp
+ *      This file will turn debounced presses and releases into clicks,
+ *      double clicks and long presses. Every button runs the same
+ *      table driven state machine, so adding a button only costs the
+ *      few bytes of its state.
+ *
+ *  @author Matt Tagupa
+ *  @date 2026-Oct-18
+ */
+
+#include "button_gestures.h"
+
+/// States of each button's gesture machine
+enum : uint8_t
+{
+    G_IDLE,                        // Up and not waiting for anything
+    G_DOWN,                        // Pressed, not yet held long enough
+    G_LONG,                        // Held down after a long press
+    G_WAIT,                        // Released, waiting for a second press
+    G_DOWN2,                       // Pressed for the second time
+    G_NUM_STATES
+};
+
+/// Inputs which make the machine change state
+enum : uint8_t
+{
+    IN_PRESS,
+    IN_RELEASE,
+    IN_TIMEOUT,
+    IN_NUM_INPUTS
+};
+
+/// Which time threshold, if any, applies in each state
+enum : uint8_t
+{
+    T_NONE,
+    T_LONG,
+    T_DOUBLE
+};
+
+/// Bit which asks for a gesture to be reported
+#define EMIT(type)  (1 << (type))
+
+/// One cell of the state table: where to go and what to report
+struct GestureTransition
+{
+    uint8_t next;
+    uint8_t emit;
+};
+
+/// The state table, indexed by state and then by input
+static const GestureTransition TABLE[G_NUM_STATES][IN_NUM_INPUTS] =
+{
+    // G_IDLE
+    {{G_DOWN,  EMIT (GESTURE_PRESS)},
+     {G_IDLE,  0},
+     {G_IDLE,  0}},
+    // G_DOWN
+    {{G_DOWN,  0},
+     {G_WAIT,  EMIT (GESTURE_RELEASE)},
+     {G_LONG,  EMIT (GESTURE_LONG_PRESS)}},
+    // G_LONG
+    {{G_LONG,  0},
+     {G_IDLE,  EMIT (GESTURE_RELEASE)},
+     {G_LONG,  0}},
+    // G_WAIT
+    {{G_DOWN2, EMIT (GESTURE_PRESS) | EMIT (GESTURE_DOUBLE_CLICK)},
+     {G_WAIT,  0},
+     {G_IDLE,  EMIT (GESTURE_CLICK)}},
+    // G_DOWN2
+    {{G_DOWN2, 0},
+     {G_IDLE,  EMIT (GESTURE_RELEASE)},
+     {G_LONG,  EMIT (GESTURE_LONG_PRESS)}}
+};
+
+/// The time threshold which applies in each state
+static const uint8_t STATE_TIMEOUT[G_NUM_STATES] =
+{
+    T_NONE, T_LONG, T_NONE, T_DOUBLE, T_LONG
+};
+
+/** @brief   Create a gesture engine for a group of buttons
+ *  @details This constructor saves the settings and puts every
+ *           button's machine in the idle state.
+ *  @param   states An array of states, one for each button, which
+ *           must exist as long as the engine does
+ *  @param   count The number of buttons, which are numbered from 0
+ *  @param   queue The queue into which gestures will be put
+ *  @param   timing The long press and double click times
+ */
+
+GestureEngine::GestureEngine (GestureState* states, uint8_t count,
+                              Queue<GestureEvent>& queue,
+                              const GestureConfig& timing)
+{
+    p_states = states;
+    num_buttons = count;
+    num_timing = 0;
+    config = timing;
+    p_queue = &queue;
+    dropped = 0;
+
+    for (uint8_t index = 0; index < count; index++)
+    {
+        p_states[index].state = G_IDLE;
+        p_states[index].since = 0;
+    }
+}
+
+/** @brief   Run one button's machine with one input
+ *  @details The next state and the gestures to report are looked up
+ *           in the table; each gesture is put into the queue with the
+ *           given time. The queue is never waited on, as this task may
+ *           serve many buttons; a gesture which doesn't fit is counted
+ *           and dropped.
+ *  @param   button The number of the button
+ *  @param   input Which input happened
+ *  @param   time The time of the input in microseconds
+ */
+
+void GestureEngine::step (uint8_t button, uint8_t input, uint32_t time)
+{
+    GestureState& gs = p_states[button];
+    const GestureTransition& cell = TABLE[gs.state][input];
+
+    for (uint8_t type = 0; cell.emit >> type; type++)
+    {
+        if (cell.emit & EMIT (type))
+        {
+            GestureEvent event;
+            event.time = time;
+            event.button = button;
+            event.type = (GestureType)type;
+            if (xQueueSendToBack (p_queue->get_handle (), &event, 0)
+                != pdTRUE)
+            {
+                dropped++;
+            }
+        }
+    }
+
+    if (cell.next != gs.state)
+    {
+        num_timing -= (STATE_TIMEOUT[gs.state] != T_NONE);
+        num_timing += (STATE_TIMEOUT[cell.next] != T_NONE);
+        gs.state = cell.next;
+        gs.since = time;
+    }
+}
+
+/** @brief   Give the engine a debounced press or release
+ *  @param   event The event from a debouncer; its @c button number
+ *           picks which machine is run
+ */
+
+void GestureEngine::edge (const ButtonEvent& event)
+{
+    if (event.button < num_buttons)
+    {
+        step (event.button,
+              event.type == BUTTON_PRESS ? IN_PRESS : IN_RELEASE,
+              event.time);
+    }
+}
+
+/** @brief   Check all the buttons for thresholds which have passed
+ *  @details This should be called every few milliseconds while
+ *           @c is_timing() returns true. Times are kept in the same
+ *           microseconds as @c micros() and compared by unsigned
+ *           subtraction, so they stay right when @c micros() wraps
+ *           around every 71 minutes.
+ *  @param   now The present time in microseconds, from @c micros()
+ */
+
+void GestureEngine::tick (uint32_t now)
+{
+    for (uint8_t button = 0; button < num_buttons && num_timing; button++)
+    {
+        uint8_t timeout = STATE_TIMEOUT[p_states[button].state];
+        if (timeout == T_NONE)
+        {
+            continue;
+        }
+
+        uint32_t limit = (timeout == T_LONG) ? config.long_press_ms
+                                             : config.double_click_ms;
+        if (now - p_states[button].since >= limit * 1000UL)
+        {
+            step (button, IN_TIMEOUT, now);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/** @file button_gestures.h
+ *      This is the header file for the button_gestures.cpp file. It
+ *      contains a state machine which turns debounced presses and
+ *      releases into clicks, double clicks and long presses for any
+ *      number of buttons.
+ *
+ *  @author Matt Tagupa
+ *  @date 2026-Oct-18
+ */
+
+// This code prevents errors if this file is #included more than once
+#ifndef  BUTTON_GESTURES_H
+#define  BUTTON_GESTURES_H
+#include <Arduino.h>
+#include "taskqueue.h"
+#include "interrupt_debouncer.h"
+
+/// The kinds of gesture which can be reported
+enum GestureType : uint8_t
+{
+    GESTURE_PRESS,                 ///< The button went down
+    GESTURE_RELEASE,               ///< The button came up
+    GESTURE_CLICK,                 ///< A short press with no second press
+    GESTURE_DOUBLE_CLICK,          ///< A second press soon after a click
+    GESTURE_LONG_PRESS             ///< The button has been held down
+};
+
+/// A gesture made with one button, sent through a queue
+struct GestureEvent
+{
+    uint32_t time;                 ///< Time of the gesture in microseconds
+    uint8_t button;                ///< Number which identifies the button
+    GestureType type;              ///< Which gesture it was
+};
+
+/// Timing thresholds which are shared by all buttons in a gesture engine
+struct GestureConfig
+{
+    uint16_t long_press_ms;        ///< Hold this long for a long press
+    uint16_t double_click_ms;      ///< Second press within this for double
+};
+
+/// The state of one button's gesture machine
+struct GestureState
+{
+    uint8_t state;                 ///< Which state the machine is in
+    uint32_t since;                ///< Time (us, wrapping) state was entered
+};
+
+/** @brief   Class which recognizes button gestures.
+ *  @details Each button has a tiny state machine which is run from a
+ *           table in flash: for each state and input (press, release or
+ *           timeout), the table gives the next state and which gestures
+ *           to report. A press and a release are always reported; a
+ *           click is reported when no second press comes within the
+ *           double click time, a double click on the second press, and
+ *           a long press once the button has been held for the long
+ *           press time.
+ *
+ *           The caller supplies an array of @c GestureState with one
+ *           element per button, so one task can handle dozens of
+ *           buttons without any memory being allocated. The engine
+ *           never waits for room in the queue; a gesture which doesn't
+ *           fit is counted and dropped, so one slow reader can't stall
+ *           every button:
+ *           @code
+ *           GestureState states[12];
+ *           GestureConfig timing = {600, 300};
+ *           GestureEngine gestures (states, 12, gesture_queue, timing);
+ *           ...
+ *           gestures.edge (button_event);    // For each press/release
+ *           gestures.tick (micros ());       // Every few milliseconds
+ *           @endcode
+ */
+class GestureEngine
+{
+protected:
+
+        // The caller's array of per-button states
+        GestureState* p_states;
+
+        // How many buttons there are
+        uint8_t num_buttons;
+
+        // Number of buttons whose machines are waiting for a timeout
+        uint8_t num_timing;
+
+        // Timing thresholds for all of the buttons
+        GestureConfig config;
+
+        // Queue into which gestures are put
+        Queue<GestureEvent>* p_queue;
+
+        // Number of gestures lost because the queue was full
+        uint16_t dropped;
+
+        // Run one button's machine with one input
+        void step (uint8_t button, uint8_t input, uint32_t time);
+
+public:
+    // Constructor for the GestureEngine class
+    GestureEngine (GestureState* states, uint8_t count,
+                   Queue<GestureEvent>& queue, const GestureConfig& timing);
+
+    // Give the engine a debounced press or release
+    void edge (const ButtonEvent& event);
+
+    // Check all the buttons for long presses and finished clicks
+    void tick (uint32_t now);
+
+    /** @brief   Check if any button is waiting for a time threshold.
+     *  @details When this returns false, @c tick() has nothing to do,
+     *           so the calling task can sleep until the next edge.
+     *  @returns True if @c tick() needs to be called
+     */
+    bool is_timing (void) { return num_timing != 0; }
+
+    /** @brief   Get the number of gestures lost because the queue was
+     *           full.
+     *  @returns The number of gestures which were dropped
+     */
+    uint16_t get_dropped (void) { return dropped; }
+};
+
+#endif  // BUTTON_GESTURES_H
@@ -30,8 +30,11 @@ Debouncer::Debouncer (uint8_t pin, uint8_t threshold)
  *           pin from main.cpp. when it is called, it will check the 
  *           state of the pin, check to see if the number of bounces
  *           exceeds the threshold, then apply a trigger if the 
- *           requirements were met
- *  @param   
+ *           requirements were met. The count is reset whenever the
+ *           pin reads low, so each new press must again pass the
+ *           threshold; while the pin stays high the output stays 0.
+ *  @returns 1 while the pin reads low, 0 once the pin has read high 
+ *           more than the threshold number of times in a row
  */
 
 bool Debouncer::update (void)
@@ -40,20 +43,27 @@ bool Debouncer::update (void)
 
     if (output == 0)
     {
+        count = 0;
         output = 1;
         return output;
     }
     else
     {
-        count = count + 1;
+        // Stop counting once past the threshold so the count can't wrap
+        if (count <= zeros)
+        {
+            count = count + 1;
+        }
 
         if (count > zeros)
         {
             output = 0;
             return output;
-            count = 0;
         }
         else
-        {} 
+        {
+            output = 1;
+            return output;
+        } 
     }
 }
\ No newline at end of file
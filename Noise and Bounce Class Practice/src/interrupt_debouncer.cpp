@@ -0,0 +1,146 @@
+/** @file interrupt_debouncer.cpp
+ *      This file will debounce a button by waking up only when its
+ *      pin has an edge. The first edge starts a lockout timer, and
+ *      when the timer runs out the new state of the button is sent
+ *      to a queue with the time of that first edge.
+ *
+ *  @author Matt Tagupa
+ *  @date 2026-Oct-18
+ */
+
+#include "interrupt_debouncer.h"
+
+/** @brief   Create an interrupt driven debouncer
+ *  @details This constructor saves the settings and creates the
+ *           lockout timer. The pin must be set up as an input before
+ *           @c begin() is called.
+ *  @param   pin This is the pin that the button is connected to
+ *  @param   queue The queue into which button events will be put
+ *  @param   lockout_ms How long after the first edge, in milliseconds,
+ *           the pin is ignored while it bounces
+ *  @param   low_active True if the pin reads low when the button is
+ *           pressed, as it does for the blue button on a Nucleo
+ *  @param   id A number put in each event to say which button it was
+ */
+
+InterruptDebouncer::InterruptDebouncer (uint8_t pin,
+                                        Queue<ButtonEvent>& queue,
+                                        uint16_t lockout_ms,
+                                        bool low_active, uint8_t id)
+{
+    IOpin = pin;
+    button_id = id;
+    active_low = low_active;
+    pressed = false;
+    locked = false;
+    edge_time = 0;
+    dropped = 0;
+    timer_failures = 0;
+    p_queue = &queue;
+
+    // One-shot timer whose ID points back to this debouncer
+    lockout_timer = xTimerCreate ("Lockout", pdMS_TO_TICKS (lockout_ms),
+                                  pdFALSE, this, lockout_done);
+}
+
+/** @brief   Start watching the button's pin for edges
+ *  @details The present state of the button is taken as the starting
+ *           debounced state, then the pin's interrupt is turned on.
+ */
+
+void InterruptDebouncer::begin (void)
+{
+    pressed = read_pressed ();
+    attachInterrupt (digitalPinToInterrupt (IOpin),
+                     [this] (void) { edge_isr (); }, CHANGE);
+}
+
+/** @brief   Read the button's pin
+ *  @returns True if the pin is at the level which means pressed
+ */
+
+bool InterruptDebouncer::read_pressed (void)
+{
+    return digitalRead (IOpin) != active_low;
+}
+
+/** @brief   Handle an edge on the button's pin
+ *  @details This runs in the interrupt. If the lockout timer isn't
+ *           already running, it saves the time and starts the timer;
+ *           otherwise the edge is a bounce and nothing is done. If the
+ *           timer can't be started because the timer task's command
+ *           queue is full, the lockout is cleared so that the next edge
+ *           tries again, and the failure is counted.
+ */
+
+void InterruptDebouncer::edge_isr (void)
+{
+    if (locked)
+    {
+        return;
+    }
+
+    locked = true;
+    edge_time = micros ();
+
+    BaseType_t woken = pdFALSE;
+    if (xTimerStartFromISR (lockout_timer, &woken) != pdPASS)
+    {
+        locked = false;
+        timer_failures++;
+    }
+    portYIELD_FROM_ISR (woken);
+}
+
+/** @brief   Finish a lockout and report the button's new state
+ *  @details This runs in the RTOS timer task when the lockout time is
+ *           over. The pin should have stopped bouncing, so it is read
+ *           once; if the level is different from the debounced state,
+ *           an event is sent. If the button went back to where it was
+ *           during the lockout, it was a glitch and nothing is sent.
+ *           The timer task must not block, so an event which doesn't
+ *           fit in the queue is counted and dropped, and if another
+ *           lockout is needed but its timer can't be started, the
+ *           lockout is cleared and counted as in @c edge_isr().
+ *  @param   timer The handle of the timer which ran out
+ */
+
+void InterruptDebouncer::lockout_done (TimerHandle_t timer)
+{
+    InterruptDebouncer* p_db = (InterruptDebouncer*)pvTimerGetTimerID (timer);
+
+    bool now_pressed = p_db->read_pressed ();
+    if (now_pressed != p_db->pressed)
+    {
+        p_db->pressed = now_pressed;
+
+        ButtonEvent event;
+        event.time = p_db->edge_time;
+        event.button = p_db->button_id;
+        event.type = now_pressed ? BUTTON_PRESS : BUTTON_RELEASE;
+
+        if (xQueueSendToBack (p_db->p_queue->get_handle (), &event, 0)
+            != pdTRUE)
+        {
+            p_db->dropped++;
+        }
+    }
+
+    // An edge between reading the pin and unlocking would have been
+    // ignored, so look once more and start another lockout if needed
+    taskENTER_CRITICAL ();
+    p_db->locked = false;
+    bool missed = (p_db->read_pressed () != p_db->pressed);
+    if (missed)
+    {
+        p_db->locked = true;
+        p_db->edge_time = micros ();
+    }
+    taskEXIT_CRITICAL ();
+
+    if (missed && xTimerStart (timer, 0) != pdPASS)
+    {
+        p_db->locked = false;
+        p_db->timer_failures++;
+    }
+}
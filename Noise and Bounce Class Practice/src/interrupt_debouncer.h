@@ -0,0 +1,124 @@
+/** @file interrupt_debouncer.h
+ *      This is the header file for the interrupt_debouncer.cpp file.
+ *      It contains the event which is sent when a button changes
+ *      state and a class which debounces a button using its pin's
+ *      edge interrupt and an RTOS software timer.
+ *
+ *  @author Matt Tagupa
+ *  @date 2026-Oct-18
+ */
+
+// This code prevents errors if this file is #included more than once
+#ifndef  INTERRUPT_DEBOUNCER_H
+#define  INTERRUPT_DEBOUNCER_H
+#include <Arduino.h>
+#include <STM32FreeRTOS.h>
+#include "taskqueue.h"
+
+/// The kinds of change a debounced button can report
+enum ButtonEventType : uint8_t
+{
+    BUTTON_PRESS,                  ///< The button has been pressed
+    BUTTON_RELEASE                 ///< The button has been released
+};
+
+/// A confirmed change of a button's state, sent through a queue
+struct ButtonEvent
+{
+    uint32_t time;                 ///< Time of the first edge in microseconds
+    uint8_t button;                ///< Number which identifies the button
+    ButtonEventType type;          ///< Whether it was pressed or released
+};
+
+/** @brief   Class which debounces a button with an interrupt and a
+ *           lockout timer instead of polling.
+ *  @details The first edge on the pin saves the time and starts a
+ *           one-shot timer; more edges during the lockout time are
+ *           ignored as bounces. When the timer runs out, the pin is
+ *           read once and, if its level differs from the debounced
+ *           state, a timestamped @c ButtonEvent is put into the queue.
+ *           Nothing runs while the button is idle, and an event is
+ *           ready one lockout time after the first edge.
+ *
+ *           A task can wait for button events like this:
+ *           @code
+ *           Queue<ButtonEvent> buttons (10, "Buttons");
+ *           InterruptDebouncer blue (PC13, buttons, 20);
+ *           ...
+ *           blue.begin ();
+ *           ...
+ *           ButtonEvent event;
+ *           buttons.get (event);         // Blocks until a press/release
+ *           @endcode
+ */
+class InterruptDebouncer
+{
+protected:
+
+        // Designated pin which is watched for edges
+        uint8_t IOpin;
+
+        // Number put into events so tasks know which button it was
+        uint8_t button_id;
+
+        // True if the pin reads low when the button is pressed
+        bool active_low;
+
+        // Debounced state, true when the button is pressed
+        volatile bool pressed;
+
+        // True while the lockout timer is running
+        volatile bool locked;
+
+        // Time of the edge which started the lockout
+        volatile uint32_t edge_time;
+
+        // Number of events which didn't fit in the queue
+        volatile uint16_t dropped;
+
+        // Number of times the lockout timer couldn't be started
+        volatile uint16_t timer_failures;
+
+        // Queue into which events are put
+        Queue<ButtonEvent>* p_queue;
+
+        // RTOS software timer which times the lockout
+        TimerHandle_t lockout_timer;
+
+        // Called from the pin's interrupt on every edge
+        void edge_isr (void);
+
+        // Called by the RTOS timer task when the lockout has ended
+        static void lockout_done (TimerHandle_t timer);
+
+        // Read the pin and convert it to pressed or not pressed
+        bool read_pressed (void);
+
+public:
+    // Constructor for the InterruptDebouncer class
+    InterruptDebouncer (uint8_t pin, Queue<ButtonEvent>& queue,
+                        uint16_t lockout_ms = 20, bool low_active = true,
+                        uint8_t id = 0);
+
+    // Start watching the pin for edges
+    void begin (void);
+
+    /** @brief   Get the debounced state of the button.
+     *  @returns True if the button is pressed, false if not
+     */
+    bool is_pressed (void) { return pressed; }
+
+    /** @brief   Get the number of events lost because the queue was
+     *           full.
+     *  @returns The number of events which were dropped
+     */
+    uint16_t get_dropped (void) { return dropped; }
+
+    /** @brief   Get the number of edges whose lockout timer couldn't be
+     *           started, so that they were ignored.
+     *  @returns The number of times starting the timer failed
+     */
+    uint16_t get_timer_failures (void) { return timer_failures; }
+};
+
+#endif  // INTERRUPT_DEBOUNCER_H
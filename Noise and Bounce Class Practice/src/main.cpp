@@ -1,48 +1,117 @@
 /** @file main.cpp
- *      This file will call the update function in debouncer.cpp 
- *      and run it every 20 milliseconds.
- * 
+ *      This file will set up a debounced button and print each press
+ *      and release as soon as it happens. The button is watched by an
+ *      interrupt instead of being polled, so the CPU does nothing
+ *      while the button isn't being touched.
+ *
  *  @author Matt Tagupa
  *  @date 2020-Oct-8
+ *  @date 2026-Oct-18 Changed from polling to interrupt driven events
+ *  @date 2026-Oct-18 Recognize clicks, double clicks and long presses
  */
 
-#define PC13 13
-//#define threshold 1
-
 // Include all of the libraries needed for this function
 #include <Arduino.h>
 #include <PrintStream.h>
-#include "debouncer.h"
+#include <STM32FreeRTOS.h>
+#include "taskqueue.h"
+#include "interrupt_debouncer.h"
+#include "button_gestures.h"
+
+/// Queue which carries button presses and releases to the printing task
+Queue<ButtonEvent> button_events (16, "Buttons");
+
+/// Queue which carries gestures to the printing task
+Queue<GestureEvent> gesture_events (16, "Gestures");
+
+/// Debouncer for the blue button on the Nucleo, with a 20 ms lockout
+InterruptDebouncer blue_button (PC13, button_events, 20);
+
+/** @brief   Task which turns button events into gestures.
+ *  @details This task sleeps until a button event arrives in the queue
+ *           and gives it to the gesture engine. While a button is
+ *           waiting for a long press or double click time to pass, the
+ *           task also wakes every 10 ms to check the time.
+ *  @param   p_params A pointer to function parameters which we don't use.
+ */
+void task_buttons (void* p_params)
+{
+    (void)p_params;
+
+    // Times which apply to all buttons: long press 600 ms, double 300 ms
+    const GestureConfig timing = {600, 300};
+    GestureState states[1];
+    GestureEngine gestures (states, 1, gesture_events, timing);
+
+    ButtonEvent event;
+
+    for (;;)
+    {
+        // Sleep until there's an event, or only a short time if timing
+        TickType_t wait = gestures.is_timing () ? pdMS_TO_TICKS (10)
+                                                : portMAX_DELAY;
+        if (xQueueReceive (button_events.get_handle (), &event, wait))
+        {
+            gestures.edge (event);
+        }
+        gestures.tick (micros ());
+    }
+}
 
-void setup() 
+/** @brief   Task which prints gestures.
+ *  @details This task sleeps until a gesture arrives in the queue, then
+ *           prints it along with how long ago it happened.
+ *  @param   p_params A pointer to function parameters which we don't use.
+ */
+void task_print (void* p_params)
 {
-  // Start the serial port, wait a short time, then say hello. Use the
+    (void)p_params;
+
+    const char* names[] = {"Press", "Release", "Click", "Double click",
+                           "Long press"};
+    GestureEvent event;
+
+    for (;;)
+    {
+        gesture_events.get (event);         // Sleeps until there's a gesture
+
+        uint32_t latency = micros () - event.time;
+        Serial << names[event.type] << " on button " << event.button 
+               << " at " << event.time << " us, " << latency 
+               << " us ago" << endl;
+    }
+}
+
+void setup()
+{
+    // Start the serial port, wait a short time, then say hello. Use the
     // non-RTOS delay() function because the RTOS hasn't been started yet
     Serial.begin (115200);
     delay (2000);
     Serial << endl << endl << "Hello, I am a demonstration of Debouncer. Press the blue button on the Nucleo when ready." << endl;
 
-  // Designate pins and threshold
-  pinMode(PC13, INPUT);
-
-  Debouncer my_db(PC13,5);
-
-  // Designate "pin" as the variable to read
-  uint8_t pin = PC13;
+    // Designate pins and start watching for edges
+    pinMode (PC13, INPUT);
+    blue_button.begin ();
 
+    xTaskCreate (task_buttons,
+                 "Buttons",                       // Name for printouts
+                 512,                             // Stack size
+                 NULL,                            // Parameters for task fn.
+                 3,                               // Priority
+                 NULL);                           // Task handle
 
-  for(;;)
-  {
-    // my_db.update();
-
-    Serial << my_db.update() << endl;
-    // Serial << my_db.count() << endl;
-    delay (1000);
-  }
+    xTaskCreate (task_print,
+                 "Print",                         // Name for printouts
+                 512,                             // Stack size
+                 NULL,                            // Parameters for task fn.
+                 2,                               // Priority
+                 NULL);                           // Task handle
 
+    vTaskStartScheduler ();
 }
 
-void loop() 
+void loop()
 {
   // put your main code here, to run repeatedly:
-}
\ No newline at end of file
+}
@@ -0,0 +1,67 @@
+/** @file port_debouncer.cpp
+ *      This file will debounce every pin of a GPIO port at the same
+ *      time using bit-sliced ("vertical") counters, so that many
+ *      buttons cost no more to debounce than one.
+ *
+ *  @author Matt Tagupa
+ *  @date 2026-Oct-18
+ */
+
+#include "port_debouncer.h"
+
+/** @brief   Create a debouncer for a whole GPIO port
+ *  @details This constructor saves the port and mask, and starts every
+ *           counter at its idle value.
+ *  @param   port The GPIO port whose input register is read, such as
+ *           @c GPIOC, or @c NULL if samples will be given to
+ *           @c update(sample) instead
+ *  @param   pin_mask The bits of the port which are debounced; other
+ *           bits always read as 0
+ *  @param   initial The debounced state to start with, which should
+ *           match what the inputs read when nothing is pressed
+ */
+
+PortDebouncer::PortDebouncer (GPIO_TypeDef* port, uint32_t pin_mask,
+                              uint32_t initial)
+{
+    p_port = port;
+    mask = pin_mask;
+    state = initial & pin_mask;
+    ct0 = 0xFFFFFFFF;
+    ct1 = 0xFFFFFFFF;
+    rising = 0;
+    falling = 0;
+}
+
+/** @brief   Read the GPIO port once and debounce all of its pins
+ *  @returns The debounced state of all the inputs
+ */
+
+uint32_t PortDebouncer::update (void)
+{
+    return update (p_port->IDR);
+}
+
+/** @brief   Debounce all of the inputs in one sample
+ *  @details Inputs which differ from their debounced state count down
+ *           from 3 to 0; when a counter rolls over, that input's
+ *           debounced state is toggled. Inputs which match their
+ *           debounced state have their counters set back to 3.
+ *  @param   sample The raw reading of all the inputs, one per bit
+ *  @returns The debounced state of all the inputs
+ */
+
+uint32_t PortDebouncer::update (uint32_t sample)
+{
+    uint32_t delta = (sample & mask) ^ state;
+
+    ct0 = ~(ct0 & delta);
+    ct1 = ct0 ^ (ct1 & delta);
+
+    uint32_t toggle = delta & ct0 & ct1;
+    state ^= toggle;
+    rising = toggle & state;
+    falling = toggle & ~state;
+
+    return state;
+}
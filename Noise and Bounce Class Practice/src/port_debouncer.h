@@ -0,0 +1,96 @@
+/** @file port_debouncer.h
+ *      This is the header file for the port_debouncer.cpp file. It
+ *      contains a class which debounces every pin of a GPIO port at
+ *      once, using one read of the port's input register per update.
+ *
+ *  @author Matt Tagupa
+ *  @date 2026-Oct-18
+ */
+
+// This code prevents errors if this file is #included more than once
+#ifndef  PORT_DEBOUNCER_H
+#define  PORT_DEBOUNCER_H
+#include <Arduino.h>
+
+/** @brief   Class which debounces up to 32 inputs at the same time.
+ *  @details Each input has a two bit counter, but the counters are
+ *           stored "vertically": bit @c n of @c ct0 and bit @c n of
+ *           @c ct1 together make the counter for input @c n. This lets
+ *           every counter be updated with a few logic operations on
+ *           whole words, so an update costs the same for 1 input or 32.
+ *           An input must read differently from its debounced state on
+ *           four updates in a row before the debounced state changes;
+ *           any update on which it matches the debounced state resets
+ *           its counter.
+ *
+ *           To debounce a GPIO port, configure its pins as inputs and
+ *           call @c update() every few milliseconds:
+ *           @code
+ *           PortDebouncer buttons (GPIOC, 0xFFFF);
+ *           ...
+ *           buttons.update ();
+ *           if (buttons.get_rising () & (1 << 13)) { ... }
+ *           @endcode
+ *           Pins from two ports can be debounced together by combining
+ *           the port registers into one 32 bit sample:
+ *           @code
+ *           both.update ((GPIOB->IDR << 16) | GPIOC->IDR);
+ *           @endcode
+ */
+class PortDebouncer
+{
+protected:
+
+        // GPIO port to read, or NULL if samples are given to update()
+        GPIO_TypeDef* p_port;
+
+        // Which bits of the sample are debounced
+        uint32_t mask;
+
+        // Debounced state of every input
+        uint32_t state;
+
+        // Low and high bits of every input's counter
+        uint32_t ct0;
+        uint32_t ct1;
+
+        // Inputs which went from 0 to 1 or 1 to 0 on the last update
+        uint32_t rising;
+        uint32_t falling;
+
+public:
+    // Constructor for the PortDebouncer class
+    PortDebouncer (GPIO_TypeDef* port, uint32_t pin_mask = 0xFFFF,
+                   uint32_t initial = 0);
+
+    // Read the port once and debounce all of its pins
+    uint32_t update (void);
+
+    // Debounce a sample which was read from somewhere else
+    uint32_t update (uint32_t sample);
+
+    /** @brief   Get the debounced state of all the inputs.
+     *  @returns One bit per input, 1 for high and 0 for low
+     */
+    uint32_t get_state (void) { return state; }
+
+    /** @brief   Get the inputs which went from low to high on the last
+     *           update.
+     *  @returns One bit per input, 1 if that input has just gone high
+     */
+    uint32_t get_rising (void) { return rising; }
+
+    /** @brief   Get the inputs which went from high to low on the last
+     *           update.
+     *  @returns One bit per input, 1 if that input has just gone low
+     */
+    uint32_t get_falling (void) { return falling; }
+
+    /** @brief   Get the inputs which changed in either direction on the
+     *           last update.
+     *  @returns One bit per input, 1 if that input has just changed
+     */
+    uint32_t get_changed (void) { return rising | falling; }
+};
+
+#endif  // PORT_DEBOUNCER_H
@@ -1,8 +1,10 @@
 /** @file dissect.h
- *      This file ...
+ *      This file contains the functions which print a number in
+ *      decimal, hexadecimal and binary, and as a sum of powers of two.
  * 
  *  @author Matt Tagupa
  *  @date 2020-Oct-8
+ *  @date 2026-Oct-18 Added versions for 16, 32 and 64 bit numbers
  */
 
 // This code prevents errors if this file is #included more than once
@@ -10,9 +12,26 @@
 #define  DISSECT_H
 #include <Arduino.h>
 #include <PrintStream.h>
+#include "number_format.h"
 
 // Function that prints a number into decimal, hexadecimal, then binary
 // Must add the semicolon to null the output from this header file
 void dissect(uint8_t number);
 
-#endif  // DISSECT_H
\ No newline at end of file
+/** @brief   Print a number of any unsigned integer type in decimal, hex,
+ *           binary, and as a sum of powers of two
+ *  @details The whole line is formatted into a buffer on the stack and
+ *           then given to the serial device in one write.
+ *  @param   number The number to be printed; its type sets how many hex
+ *           and binary digits are shown
+ *  @param   printer The serial device, such as @c Serial, to print on
+ */
+template <class T>
+void dissect (T number, Print& printer)
+{
+    char buffer[dissect_buffer_size<T> ()];
+    size_t length = format_dissected (buffer, sizeof (buffer), number);
+    printer.write ((const uint8_t*)buffer, length);
+}
+
+#endif  // DISSECT_H
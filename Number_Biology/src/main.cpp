@@ -22,6 +22,8 @@ void setup ()
   // Trying different values for the dissect.cpp function
     dissect (0);
     dissect (10);
+    dissect ((uint16_t)0xBEEF, Serial);
+    dissect ((uint32_t)123456789, Serial);
 }
 
 // Code that is run in a continual loop after the setup
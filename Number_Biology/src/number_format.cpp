@@ -0,0 +1,69 @@
+/** @file number_format.cpp
+ *      This file holds the lookup tables used by the number formatter
+ *      in number_format.h. They are constant, so they stay in flash.
+ *
+ *  @author Matt Tagupa
+ *  @date 2026-Oct-18
+ */
+
+#include "number_format.h"
+
+/// Decimal digit pairs "00" through "99", two characters each, then a \0
+const char DIGIT_PAIRS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/// Hexadecimal digit for each nibble value
+const char HEX_DIGITS[16] =
+{
+    '0', '1', '2', '3', '4', '5', '6', '7',
+    '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+};
+
+/// Four binary digits for each nibble value, most significant first
+const char NIBBLE_BITS[16][4] =
+{
+    {'0', '0', '0', '0'},
+    {'0', '0', '0', '1'},
+    {'0', '0', '1', '0'},
+    {'0', '0', '1', '1'},
+    {'0', '1', '0', '0'},
+    {'0', '1', '0', '1'},
+    {'0', '1', '1', '0'},
+    {'0', '1', '1', '1'},
+    {'1', '0', '0', '0'},
+    {'1', '0', '0', '1'},
+    {'1', '0', '1', '0'},
+    {'1', '0', '1', '1'},
+    {'1', '1', '0', '0'},
+    {'1', '1', '0', '1'},
+    {'1', '1', '1', '0'},
+    {'1', '1', '1', '1'}
+};
+
+/// Each power of two from 2^0 to 2^63, in decimal
+const char* const POWERS_OF_TWO[64] =
+{
+    "1", "2", "4", "8", "16", "32", "64", "128", "256", "512", "1024",
+    "2048", "4096", "8192", "16384", "32768", "65536", "131072", "262144",
+    "524288", "1048576", "2097152", "4194304", "8388608", "16777216",
+    "33554432", "67108864", "134217728", "268435456", "536870912",
+    "1073741824", "2147483648", "4294967296", "8589934592", "17179869184",
+    "34359738368", "68719476736", "137438953472", "274877906944",
+    "549755813888", "1099511627776", "2199023255552", "4398046511104",
+    "8796093022208", "17592186044416", "35184372088832", "70368744177664",
+    "140737488355328", "281474976710656", "562949953421312",
+    "1125899906842624", "2251799813685248", "4503599627370496",
+    "9007199254740992", "18014398509481984", "36028797018963968",
+    "72057594037927936", "144115188075855872", "288230376151711744",
+    "576460752303423488", "1152921504606846976", "2305843009213693952",
+    "4611686018427387904", "9223372036854775808"
+};
@@ -0,0 +1,159 @@
+/** @file number_format.h
+ *      This file contains a table driven formatter which writes an
+ *      unsigned integer in decimal, hexadecimal and binary, followed by
+ *      the sum of powers of two which make it up, into a character
+ *      buffer. Nothing is printed until the whole line is ready, so the
+ *      line can be sent to a serial port with a single write.
+ *
+ *  @author Matt Tagupa
+ *  @date 2026-Oct-18
+ */
+
+// This code prevents errors if this file is #included more than once
+#ifndef  NUMBER_FORMAT_H
+#define  NUMBER_FORMAT_H
+#include <Arduino.h>
+
+/// Decimal digit pairs "00" through "99", two characters each, then a \0
+extern const char DIGIT_PAIRS[201];
+
+/// Hexadecimal digit for each nibble value
+extern const char HEX_DIGITS[16];
+
+/// Four binary digits for each nibble value, most significant first
+extern const char NIBBLE_BITS[16][4];
+
+/// Each power of two from 2^0 to 2^63, in decimal
+extern const char* const POWERS_OF_TWO[64];
+
+/** @brief   Find how many decimal digits 2 to the @c power has.
+ *  @param   power The exponent, from 0 to 63
+ *  @returns The number of digits
+ */
+constexpr uint8_t power_of_two_digits (uint8_t power)
+{
+    return (uint8_t)((power * 1233U) >> 12) + 1;
+}
+
+/** @brief   Find a buffer size big enough for any line made by
+ *           @c format_dissected() for a given type.
+ *  @details Room is left for the decimal, hex and binary forms, a full
+ *           sum of every power of two, and a line ending.
+ *  @tparam  T The unsigned integer type which will be formatted
+ *  @returns The number of characters needed
+ */
+template <class T>
+constexpr size_t dissect_buffer_size (void)
+{
+    return 20 + (6 + 2 * sizeof (T)) + (6 + 8 * sizeof (T)) + 4
+           + 8 * sizeof (T) * (power_of_two_digits (8 * sizeof (T) - 1) + 3)
+           + 2;
+}
+
+/** @brief   Write an unsigned integer in decimal.
+ *  @details Digits are made two at a time from a table, working from the
+ *           right end of a scratch area, then copied to the buffer.
+ *  @param   p_out Where to put the digits; no @c \0 is added
+ *  @param   number The number to be written
+ *  @returns The number of characters written
+ */
+template <class T>
+size_t format_decimal (char* p_out, T number)
+{
+    char digits[20];
+    char* p_digit = digits + sizeof (digits);
+
+    while (number >= 100)
+    {
+        uint8_t pair = number % 100;
+        number /= 100;
+        p_digit -= 2;
+        memcpy (p_digit, DIGIT_PAIRS + 2 * pair, 2);
+    }
+    if (number >= 10)
+    {
+        p_digit -= 2;
+        memcpy (p_digit, DIGIT_PAIRS + 2 * number, 2);
+    }
+    else
+    {
+        *--p_digit = '0' + number;
+    }
+
+    size_t length = digits + sizeof (digits) - p_digit;
+    memcpy (p_out, p_digit, length);
+    return length;
+}
+
+/** @brief   Write a number in decimal, hex and binary, then as a sum of
+ *           powers of two.
+ *  @details For example, 10 in a @c uint8_t is written as
+ *           <tt>10 == 0x0A == 0b00001010 == 8 + 2</tt> followed by a
+ *           carriage return and newline. The hex and binary forms show
+ *           every digit of the type, so each byte costs the same two
+ *           table lookups no matter how wide the type is.
+ *  @tparam  T An unsigned integer type of 8, 16, 32 or 64 bits
+ *  @param   buffer The character buffer in which to write; a buffer of
+ *           @c dissect_buffer_size<T>() characters is always big enough
+ *  @param   size The size of the buffer
+ *  @param   number The number to be written
+ *  @returns The number of characters written, or 0 if the buffer is too
+ *           small to be sure the line will fit; no @c \0 is added
+ */
+template <class T>
+size_t format_dissected (char* buffer, size_t size, T number)
+{
+    static_assert ((T)(-1) > 0, "format_dissected() needs an unsigned type");
+
+    if (size < dissect_buffer_size<T> ())
+    {
+        return 0;
+    }
+    char* p_out = buffer;
+
+    p_out += format_decimal (p_out, number);
+
+    // Hex and binary, one byte (two nibbles) at a time from the top
+    memcpy (p_out, " == 0x", 6);
+    p_out += 6;
+    char* p_bits = p_out + 2 * sizeof (T) + 6;
+    memcpy (p_bits - 6, " == 0b", 6);
+    for (int8_t shift = 8 * sizeof (T) - 4; shift >= 0; shift -= 4)
+    {
+        uint8_t nibble = (number >> shift) & 0x0F;
+        *p_out++ = HEX_DIGITS[nibble];
+        memcpy (p_bits, NIBBLE_BITS[nibble], 4);
+        p_bits += 4;
+    }
+    p_out = p_bits;
+
+    // The sum of powers of two, biggest first
+    memcpy (p_out, " == ", 4);
+    p_out += 4;
+    if (number == 0)
+    {
+        *p_out++ = '0';
+    }
+    bool first = true;
+    for (int8_t bit = 8 * sizeof (T) - 1; bit >= 0; bit--)
+    {
+        if ((number >> bit) & 1)
+        {
+            if (!first)
+            {
+                memcpy (p_out, " + ", 3);
+                p_out += 3;
+            }
+            first = false;
+            uint8_t length = power_of_two_digits (bit);
+            memcpy (p_out, POWERS_OF_TWO[bit], length);
+            p_out += length;
+        }
+    }
+    *p_out++ = '\r';
+    *p_out++ = '\n';
+
+    return p_out - buffer;
+}
+
+#endif  // NUMBER_FORMAT_H
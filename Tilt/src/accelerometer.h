@@ -0,0 +1,92 @@
+/** @file accelerometer.h
+ *    This file contains an abstract interface to accelerometers. Code which
+ *    uses acceleration data, such as a tilt estimator, can be written once
+ *    against @c IAccelerometer and then be given any sensor which has an
+ *    adapter, such as an MMA8452Q or a BNO055.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _ACCELEROMETER_H_
+#define _ACCELEROMETER_H_
+
+#include <Arduino.h>
+
+
+/** @brief   One reading of all three axes, with the time it was taken.
+ *  @details Readings are in the sensor's own counts; multiply by the
+ *           sensor's @c get_scale() to get g's.
+ */
+struct AccelFrame
+{
+    uint32_t time;                    ///< Time in microseconds of the sample
+    int16_t x;                        ///< Acceleration along X in counts
+    int16_t y;                        ///< Acceleration along Y in counts
+    int16_t z;                        ///< Acceleration along Z in counts
+};
+
+
+/** @brief   Abstract accelerometer which gives out readings in batches.
+ *  @details Readings are moved a batch at a time by @c read_frames(), so
+ *           there's one virtual call per batch rather than per sample, and
+ *           the loop over the samples in a batch is plain code which the
+ *           compiler can optimize:
+ *           @code
+ *           void task_tilt (void* p_params)
+ *           {
+ *               IAccelerometer* p_sensor = (IAccelerometer*)p_params;
+ *               float g_per_count = p_sensor->get_scale ();
+ *               AccelFrame frames[8];
+ *               for (;;)
+ *               {
+ *                   uint16_t count = p_sensor->read_frames (frames, 8);
+ *                   for (uint16_t index = 0; index < count; index++)
+ *                   {
+ *                       ...                 // Use frames[index]
+ *                   }
+ *               }
+ *           }
+ *           @endcode
+ *           Code which knows the type of its sensor can call the adapter
+ *           itself, and then the call is resolved when it's compiled.
+ */
+class IAccelerometer
+{
+public:
+    /** @brief   Destroy a sensor, including any which is deleted through a
+     *           pointer to this interface.
+     */
+    virtual ~IAccelerometer (void) { }
+
+    /** @brief   Get the sensor ready to take readings.
+     *  @details This is called by the task which reads the sensor, after the
+     *           RTOS has started.
+     *  @returns True if the sensor is working, false if not
+     */
+    virtual bool begin (void) = 0;
+
+    /** @brief   Get the readings which the sensor has taken.
+     *  @details If no readings are waiting, this method blocks until at least
+     *           one is, then returns every reading which is waiting, up to
+     *           @c max of them, oldest first.
+     *  @param   p_frames An array into which the readings are put
+     *  @param   max The largest number of readings to put into @c p_frames
+     *  @returns The number of readings put into @c p_frames, or 0 if the
+     *           sensor couldn't be read
+     */
+    virtual uint16_t read_frames (AccelFrame* p_frames, uint16_t max) = 0;
+
+    /** @brief   Get the scale of the readings.
+     *  @returns The number of g's in one count
+     */
+    virtual float get_scale (void) = 0;
+
+    /** @brief   Get the output data rate.
+     *  @returns The number of readings the sensor takes each second
+     */
+    virtual float get_odr (void) = 0;
+};
+
+#endif // _ACCELEROMETER_H_
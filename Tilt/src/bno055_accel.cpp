@@ -0,0 +1,65 @@
+/** @file bno055_accel.cpp
+ *    This file contains source code for an @c IAccelerometer adapter which
+ *    reads the accelerometer in a BNO055.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include "bno055_accel.h"
+
+
+/** @brief   Create an adapter for a BNO055.
+ *  @param   imu The BNO055 on a managed I2C bus
+ *  @param   rate_hz The number of readings to take each second
+ */
+BNO055Accel::BNO055Accel (I2CDevice& imu, uint16_t rate_hz)
+    : p_imu (&imu), rate_hz (rate_hz), wake_time (0)
+{
+    period = pdMS_TO_TICKS (1000 / rate_hz);
+}
+
+
+/** @brief   Check that the BNO055 is there and start its accelerometer.
+ *  @details This must be called from a task, as it waits for the mode change.
+ *  @returns True if the BNO055 answered with its chip ID, false if not
+ */
+bool BNO055Accel::begin (void)
+{
+    uint8_t chip_id = 0;
+    if (!p_imu->read (BNO055_CHIP_ID, &chip_id, 1) || chip_id != 0xA0)
+    {
+        return false;
+    }
+    p_imu->write (BNO055_OPR_MODE, BNO055_MODE_ACCONLY);
+    vTaskDelay (pdMS_TO_TICKS (20));    // Mode changes take up to 19 ms
+    wake_time = xTaskGetTickCount ();
+    return true;
+}
+
+
+/** @brief   Wait for the next sample time and read one frame.
+ *  @param   p_frames An array into which the frame is put
+ *  @param   max The size of @c p_frames; only one frame is read at a time
+ *  @returns 1 if a frame was read, or 0 if the BNO055 couldn't be read
+ */
+uint16_t BNO055Accel::read_frames (AccelFrame* p_frames, uint16_t max)
+{
+    if (max == 0)
+    {
+        return 0;
+    }
+    vTaskDelayUntil (&wake_time, period);
+
+    uint8_t raw[6];
+    if (!p_imu->read (BNO055_ACC_DATA, raw, 6))
+    {
+        return 0;
+    }
+    p_frames[0].time = micros ();
+    p_frames[0].x = (int16_t)(raw[1] << 8 | raw[0]);
+    p_frames[0].y = (int16_t)(raw[3] << 8 | raw[2]);
+    p_frames[0].z = (int16_t)(raw[5] << 8 | raw[4]);
+    return 1;
+}
@@ -0,0 +1,84 @@
+/** @file bno055_accel.h
+ *    This file contains the headers for an @c IAccelerometer adapter which
+ *    reads the accelerometer in a BNO055 through the I2C bus manager.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _BNO055_ACCEL_H_
+#define _BNO055_ACCEL_H_
+
+#include <Arduino.h>
+#if (defined STM32L4xx || defined STM32F4xx)
+    #include <STM32FreeRTOS.h>
+#endif
+#include "accelerometer.h"
+#include "i2c_bus_manager.h"
+
+
+/// BNO055 register which holds the chip ID
+const uint8_t BNO055_CHIP_ID = 0x00;
+
+/// BNO055 register which holds the first byte of the acceleration data
+const uint8_t BNO055_ACC_DATA = 0x08;
+
+/// BNO055 register which sets the operating mode
+const uint8_t BNO055_OPR_MODE = 0x3D;
+
+/// BNO055 operating mode with only the accelerometer running
+const uint8_t BNO055_MODE_ACCONLY = 0x01;
+
+
+/** @brief   Adapter which lets a BNO055 be used as an @c IAccelerometer.
+ *  @details The BNO055 has no FIFO, so the adapter reads it on a schedule:
+ *           each call to @c read_frames() waits for the next sample time,
+ *           then reads X, Y, and Z in one burst and returns one frame. The
+ *           accelerometer is run in its accelerometer-only mode at its
+ *           default range of 4 g, and readings are in units of 0.01 m/s^2.
+ *           @code
+ *           I2CBus i2c_bus (Wire);
+ *           I2CDevice imu_a (i2c_bus, 0x28, "IMU A", 400000);
+ *           BNO055Accel accel_a (imu_a, 100);
+ *           ...
+ *           xTaskCreate (task_accelerometer, "IMU A", 512, &accel_a, 4, NULL);
+ *           @endcode
+ */
+class BNO055Accel : public IAccelerometer
+{
+protected:
+    /// The BNO055 on the managed I2C bus
+    I2CDevice* p_imu;
+
+    /// The number of readings to take each second
+    uint16_t rate_hz;
+
+    /// The number of RTOS ticks between readings
+    TickType_t period;
+
+    /// The RTOS time at which the latest reading was due
+    TickType_t wake_time;
+
+public:
+    // Create an adapter for a BNO055
+    BNO055Accel (I2CDevice& imu, uint16_t rate_hz = 100);
+
+    // Check that the BNO055 is there and start its accelerometer
+    bool begin (void);
+
+    // Wait for the next sample time and read one frame
+    uint16_t read_frames (AccelFrame* p_frames, uint16_t max);
+
+    /** @brief   Get the scale of the readings.
+     *  @returns The number of g's in one count of 0.01 m/s^2
+     */
+    float get_scale (void) { return 0.01f / 9.80665f; }
+
+    /** @brief   Get the rate at which readings are taken.
+     *  @returns The number of readings taken each second
+     */
+    float get_odr (void) { return rate_hz; }
+};
+
+#endif // _BNO055_ACCEL_H_
@@ -0,0 +1,102 @@
+/** @file bno055_fusion.cpp
+ *    This file contains source code for a reader which gets a BNO055's fused
+ *    orientation outputs in one I2C burst.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#if (defined STM32L4xx || defined STM32F4xx)
+    #include <STM32FreeRTOS.h>
+#endif
+#include "bno055_fusion.h"
+
+
+/** @brief   Get a signed 16-bit number from two bytes, low byte first.
+ *  @param   p_bytes Pointer to the low byte
+ *  @returns The number
+ */
+static inline int16_t get_int16 (const uint8_t* p_bytes)
+{
+    return (int16_t)(p_bytes[1] << 8 | p_bytes[0]);
+}
+
+
+/** @brief   Create a reader for a BNO055.
+ *  @param   imu The BNO055 on a managed I2C bus
+ */
+BNO055FusionReader::BNO055FusionReader (I2CDevice& imu)
+    : p_imu (&imu)
+{
+}
+
+
+/** @brief   Check that the BNO055 is there and start sensor fusion.
+ *  @details The BNO055 is put in configuration mode, then in NDOF mode, in
+ *           which it fuses its accelerometer, gyroscope, and magnetometer
+ *           readings. The default units are used: m/s^2, degrees, and
+ *           degrees C. This must be called from a task, as it waits for the
+ *           mode changes.
+ *  @returns True if the BNO055 answered with its chip ID, false if not
+ */
+bool BNO055FusionReader::begin (void)
+{
+    uint8_t chip_id = 0;
+    if (!p_imu->read (BNO055_CHIP_ID, &chip_id, 1) || chip_id != 0xA0)
+    {
+        return false;
+    }
+    p_imu->write (BNO055_OPR_MODE, BNO055_MODE_CONFIG);
+    vTaskDelay (pdMS_TO_TICKS (20));    // Going to config mode takes 19 ms
+    p_imu->write (BNO055_OPR_MODE, BNO055_MODE_NDOF);
+    vTaskDelay (pdMS_TO_TICKS (10));    // Leaving config mode takes 7 ms
+    return true;
+}
+
+
+/** @brief   Read and convert all the fused outputs in one transaction.
+ *  @param   data The structure into which the outputs are put
+ *  @returns True if the BNO055 was read, false if not, in which case
+ *           @c data isn't changed
+ */
+bool BNO055FusionReader::read (BNO055Fusion& data)
+{
+    uint8_t raw[BNO055_FUSION_BYTES];
+    if (!p_imu->read (BNO055_EUL_DATA, raw, BNO055_FUSION_BYTES))
+    {
+        return false;
+    }
+    data.time = micros ();
+    decode (raw, data);
+    return true;
+}
+
+
+/** @brief   Convert a block of fused output registers to fixed-point units.
+ *  @details The block holds, in order: Euler angles at 16 counts per degree,
+ *           the quaternion in Q14, linear acceleration and gravity at 100
+ *           counts per m/s^2, temperature, and calibration status. Only
+ *           integer arithmetic is used.
+ *  @param   p_raw The bytes read, starting at @c EUL_DATA
+ *  @param   data The structure into which the outputs are put; its time
+ *           isn't changed
+ */
+void BNO055FusionReader::decode (const uint8_t* p_raw, BNO055Fusion& data)
+{
+    for (uint8_t axis = 0; axis < 3; axis++)
+    {
+        // 1/16 degree to 1/100 degree is times 25/4
+        data.euler[axis] = (int32_t)get_int16 (p_raw + 2 * axis) * 25 / 4;
+
+        // 1/100 m/s^2 to mm/s^2 is times 10
+        data.linear[axis] = (int32_t)get_int16 (p_raw + 14 + 2 * axis) * 10;
+        data.gravity[axis] = (int32_t)get_int16 (p_raw + 20 + 2 * axis) * 10;
+    }
+    for (uint8_t index = 0; index < 4; index++)
+    {
+        data.quat[index] = get_int16 (p_raw + 6 + 2 * index);
+    }
+    data.temperature = (int8_t)p_raw[26];
+    data.calibration = p_raw[27];
+}
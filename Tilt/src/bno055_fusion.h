@@ -0,0 +1,91 @@
+/** @file bno055_fusion.h
+ *    This file contains the headers for a reader which gets a BNO055's fused
+ *    orientation outputs in one I2C burst. The BNO055's Euler angles,
+ *    quaternion, linear acceleration, gravity vector, temperature, and
+ *    calibration status are in one block of registers, so they can all be
+ *    read in a single 28 byte transaction and converted to fixed-point units
+ *    with integer arithmetic only.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _BNO055_FUSION_H_
+#define _BNO055_FUSION_H_
+
+#include <Arduino.h>
+#include "i2c_bus_manager.h"
+#include "bno055_accel.h"                   // BNO055 register addresses
+
+
+/// BNO055 register which holds the first byte of the Euler angles, the start
+/// of the block of fused outputs
+const uint8_t BNO055_EUL_DATA = 0x1A;
+
+/// Number of bytes from @c BNO055_EUL_DATA through @c CALIB_STAT
+const uint8_t BNO055_FUSION_BYTES = 28;
+
+/// BNO055 operating mode in which settings can be changed
+const uint8_t BNO055_MODE_CONFIG = 0x00;
+
+/// BNO055 operating mode with full 9 degree of freedom sensor fusion
+const uint8_t BNO055_MODE_NDOF = 0x0C;
+
+
+/** @brief   One set of fused outputs from a BNO055, in fixed-point units.
+ *  @details Angles are in hundredths of a degree, accelerations in mm/s^2,
+ *           and the quaternion is left in the BNO055's Q14 format, in which
+ *           16384 means 1.0.
+ */
+struct BNO055Fusion
+{
+    uint32_t time;                    ///< Time in microseconds of the read
+    int16_t quat[4];                  ///< Quaternion w, x, y, z in Q14
+    int32_t euler[3];                 ///< Heading, roll, pitch in 0.01 deg
+    int32_t linear[3];                ///< Linear acceleration X, Y, Z, mm/s^2
+    int32_t gravity[3];               ///< Gravity vector X, Y, Z in mm/s^2
+    int8_t temperature;               ///< Temperature in degrees C
+    uint8_t calibration;              ///< @c CALIB_STAT: system, gyro, accel,
+                                      ///< and magnetometer, 2 bits each
+};
+
+
+/** @brief   Class which reads a BNO055's fused outputs in one burst.
+ *  @details The BNO055 updates its fused outputs 100 times a second, so
+ *           @c read() is meant to be called from a task every 10 ms:
+ *           @code
+ *           I2CDevice imu_a (i2c_bus, 0x28, "IMU A", 400000);
+ *           BNO055FusionReader fusion_a (imu_a);
+ *           Share<BNO055Fusion> fusion_data ("Fusion");
+ *           ...
+ *           fusion_a.begin ();
+ *           for (;;)
+ *           {
+ *               BNO055Fusion data;
+ *               if (fusion_a.read (data)) fusion_data.put (data);
+ *               vTaskDelayUntil (&wake_time, pdMS_TO_TICKS (10));
+ *           }
+ *           @endcode
+ */
+class BNO055FusionReader
+{
+protected:
+    /// The BNO055 on the managed I2C bus
+    I2CDevice* p_imu;
+
+public:
+    // Create a reader for a BNO055
+    BNO055FusionReader (I2CDevice& imu);
+
+    // Check that the BNO055 is there and start sensor fusion
+    bool begin (void);
+
+    // Read and convert all the fused outputs in one transaction
+    bool read (BNO055Fusion& data);
+
+    // Convert a block of fused output registers to fixed-point units
+    static void decode (const uint8_t* p_raw, BNO055Fusion& data);
+};
+
+#endif // _BNO055_FUSION_H_
@@ -0,0 +1,229 @@
+/** @file i2c_bus_manager.cpp
+ *    This file contains source code for a layer which lets several tasks
+ *    share one I2C bus safely, with each device getting its own clock speed,
+ *    timeout and usage statistics.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include <PrintStream.h>
+#include "i2c_bus_manager.h"
+
+
+/** @brief   Create a bus manager for an I2C port.
+ *  @details The mutex is made here so that devices may be used as soon as
+ *           @c begin() has been called.
+ *  @param   wire The Arduino I2C port, such as @c Wire, to be managed
+ */
+I2CBus::I2CBus (TwoWire& wire)
+{
+    p_wire = &wire;
+    mutex = xSemaphoreCreateMutex ();
+    clock_hz = 100000;                  // The Wire library's default speed
+    p_newest = NULL;
+}
+
+
+/** @brief   Start the I2C port.
+ *  @details This is the only place where @c begin() is called for the port,
+ *           so tasks sharing the bus don't restart it under each other.
+ */
+void I2CBus::begin (void)
+{
+    xSemaphoreTake (mutex, portMAX_DELAY);
+    p_wire->begin ();
+    p_wire->setClock (clock_hz);
+    xSemaphoreGive (mutex);
+}
+
+
+/** @brief   Print a table of every device's bus statistics.
+ *  @details The bus time is given as a percentage of the time since startup,
+ *           which shows at a glance which device takes most of the bus.
+ *  @param   printer The serial device, such as @c Serial, on which to print
+ */
+void I2CBus::print_stats (Print& printer)
+{
+    uint32_t now = micros ();
+
+    printer << "Device   Addr  Trans    Bytes    NAKs  Timeouts  Bus%" << endl;
+    for (I2CDevice* p_dev = p_newest; p_dev != NULL; p_dev = p_dev->p_next)
+    {
+        const I2CDeviceStats& st = p_dev->stats;
+        printer << p_dev->name << "\t 0x" << hex << p_dev->address << dec
+                << "  " << st.transactions << "  " << st.bytes
+                << "  " << st.naks << "  " << st.timeouts
+                << "  " << (now ? st.busy_us * 100.0f / now : 0.0f) << endl;
+    }
+}
+
+
+/** @brief   Create an object for a device on a managed bus.
+ *  @details The device is added to the bus's list so its statistics can be
+ *           printed. Devices should be made at startup, before the tasks
+ *           which use them are running.
+ *  @param   bus The managed bus which the device is on
+ *  @param   address The device's 7-bit I2C address
+ *  @param   name A short name for printouts; the string must not go away
+ *  @param   clock_hz The bus clock speed for this device, in Hz
+ *  @param   timeout_ms The longest time to wait for the bus to be free and,
+ *           where the @c Wire library supports it, for a transfer
+ */
+I2CDevice::I2CDevice (I2CBus& bus, uint8_t address, const char* name,
+                      uint32_t clock_hz, uint16_t timeout_ms)
+{
+    p_bus = &bus;
+    this->address = address;
+    this->name = name;
+    this->clock_hz = clock_hz;
+    this->timeout_ms = timeout_ms;
+    memset (&stats, 0, sizeof (stats));
+
+    p_next = bus.p_newest;
+    bus.p_newest = this;
+}
+
+
+/** @brief   Take the bus and set it up for this device.
+ *  @details The clock is only changed if the last device used another speed.
+ *  @returns True if the bus was taken, false if it stayed busy for longer
+ *           than this device's timeout
+ */
+bool I2CDevice::acquire (void)
+{
+    if (xSemaphoreTake (p_bus->mutex, pdMS_TO_TICKS (timeout_ms)) != pdTRUE)
+    {
+        stats.timeouts++;
+        return false;
+    }
+    stats.transactions++;
+
+    if (p_bus->clock_hz != clock_hz)
+    {
+        p_bus->p_wire->setClock (clock_hz);
+        p_bus->clock_hz = clock_hz;
+    }
+    #ifdef WIRE_HAS_TIMEOUT
+        p_bus->p_wire->setWireTimeout (timeout_ms * 1000UL, true);
+    #endif
+    return true;
+}
+
+
+/** @brief   Give the bus back and count the time it was held.
+ *  @param   start The time, from @c micros(), at which the bus was taken
+ */
+void I2CDevice::release (uint32_t start)
+{
+    stats.busy_us += micros () - start;
+    xSemaphoreGive (p_bus->mutex);
+}
+
+
+/** @brief   Read a block of registers from the device.
+ *  @param   reg The first register to be read
+ *  @param   p_data Where to put the bytes which are read
+ *  @param   length The number of bytes to read, at most the size of the
+ *           @c Wire library's buffer
+ *  @returns True if all the bytes were read, false if the bus was busy too
+ *           long or the device didn't answer
+ */
+bool I2CDevice::read (uint8_t reg, uint8_t* p_data, uint8_t length)
+{
+    if (!acquire ())
+    {
+        return false;
+    }
+    uint32_t start = micros ();
+
+    TwoWire* p_wire = p_bus->p_wire;
+    p_wire->beginTransmission (address);
+    p_wire->write (reg);
+    bool ok = p_wire->endTransmission (false) == 0
+              && p_wire->requestFrom (address, length) == length;
+    if (ok)
+    {
+        for (uint8_t index = 0; index < length; index++)
+        {
+            p_data[index] = p_wire->read ();
+        }
+        stats.bytes += length;
+    }
+    else
+    {
+        stats.naks++;
+    }
+
+    release (start);
+    return ok;
+}
+
+
+/** @brief   Write a block of registers in the device.
+ *  @param   reg The first register to be written
+ *  @param   p_data The bytes to be written
+ *  @param   length The number of bytes to write
+ *  @returns True if the device took all the bytes, false if the bus was busy
+ *           too long or the device didn't acknowledge
+ */
+bool I2CDevice::write (uint8_t reg, const uint8_t* p_data, uint8_t length)
+{
+    if (!acquire ())
+    {
+        return false;
+    }
+    uint32_t start = micros ();
+
+    TwoWire* p_wire = p_bus->p_wire;
+    p_wire->beginTransmission (address);
+    p_wire->write (reg);
+    p_wire->write (p_data, length);
+    bool ok = p_wire->endTransmission () == 0;
+    if (ok)
+    {
+        stats.bytes += length;
+    }
+    else
+    {
+        stats.naks++;
+    }
+
+    release (start);
+    return ok;
+}
+
+
+/** @brief   Write one register in the device.
+ *  @param   reg The register to be written
+ *  @param   value The value to put into the register
+ *  @returns True if the device acknowledged, false if not
+ */
+bool I2CDevice::write (uint8_t reg, uint8_t value)
+{
+    return write (reg, &value, 1);
+}
+
+
+/** @brief   Check whether the device answers its address.
+ *  @returns True if the device acknowledged, false if not
+ */
+bool I2CDevice::probe (void)
+{
+    if (!acquire ())
+    {
+        return false;
+    }
+    uint32_t start = micros ();
+
+    p_bus->p_wire->beginTransmission (address);
+    bool ok = p_bus->p_wire->endTransmission () == 0;
+    if (!ok)
+    {
+        stats.naks++;
+    }
+
+    release (start);
+    return ok;
+}
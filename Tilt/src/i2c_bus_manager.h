@@ -0,0 +1,148 @@
+/** @file i2c_bus_manager.h
+ *    This file contains the headers for a layer which lets several tasks share
+ *    one I2C bus. Each device on the bus gets an @c I2CDevice object which
+ *    knows the device's address, the clock speed and timeout it needs, and
+ *    keeps statistics on how much it has used the bus. Every transaction is
+ *    done while holding the bus's mutex, so transactions from different tasks
+ *    can't get mixed together.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _I2C_BUS_MANAGER_H_
+#define _I2C_BUS_MANAGER_H_
+
+#include <Arduino.h>
+#include <Wire.h>
+#if (defined STM32L4xx || defined STM32F4xx)
+    #include <STM32FreeRTOS.h>
+#endif
+
+
+class I2CDevice;
+
+
+/// Statistics about one device's use of the bus
+struct I2CDeviceStats
+{
+    uint32_t transactions;            ///< Number of transactions done
+    uint32_t bytes;                   ///< Number of data bytes moved
+    uint32_t naks;                    ///< Transactions which weren't ACK'd
+    uint32_t timeouts;                ///< Times the bus couldn't be taken
+    uint32_t busy_us;                 ///< Microseconds spent holding the bus
+};
+
+
+/** @brief   Class which arbitrates the use of one I2C bus among tasks.
+ *  @details The bus is guarded by a FreeRTOS mutex. Such a mutex has priority
+ *           inheritance, so a low priority task holding the bus is raised to
+ *           the priority of a higher one waiting for it, and the high
+ *           priority task isn't held up by tasks in between. Only one
+ *           @c I2CBus should be made for each @c TwoWire object, and all
+ *           transactions on that bus should go through @c I2CDevice objects.
+ */
+class I2CBus
+{
+protected:
+    /// The Arduino I2C port which this object manages
+    TwoWire* p_wire;
+
+    /// Mutex which a task must hold to use the bus
+    SemaphoreHandle_t mutex;
+
+    /// The clock speed which the bus is set to now, in Hz
+    uint32_t clock_hz;
+
+    /// The most recently made device on this bus, the head of a list
+    I2CDevice* p_newest;
+
+    friend class I2CDevice;
+
+public:
+    // Create a bus manager for an I2C port
+    I2CBus (TwoWire& wire);
+
+    // Start the I2C port; this must be done once, before any transactions
+    void begin (void);
+
+    // Print a table of every device's bus statistics
+    void print_stats (Print& printer);
+};
+
+
+/** @brief   Class which does I2C transactions with one device on a shared bus.
+ *  @details Each transaction takes the bus's mutex, sets the clock to this
+ *           device's speed if it isn't there already, does the transfer, and
+ *           gives the mutex back. For example:
+ *           @code
+ *           I2CBus bus (Wire);
+ *           I2CDevice imu (bus, 0x28, "BNO055", 400000);
+ *           ...
+ *           bus.begin ();
+ *           uint8_t data[6];
+ *           if (imu.read (0x08, data, 6)) ...
+ *           @endcode
+ */
+class I2CDevice
+{
+protected:
+    /// The bus which this device is on
+    I2CBus* p_bus;
+
+    /// The device's 7-bit I2C address
+    uint8_t address;
+
+    /// A short name used when printing statistics
+    const char* name;
+
+    /// The clock speed this device is to be run at, in Hz
+    uint32_t clock_hz;
+
+    /// The longest time to wait for the bus or for a transfer, in ms
+    uint16_t timeout_ms;
+
+    /// Statistics about this device's use of the bus
+    I2CDeviceStats stats;
+
+    /// The device made before this one on the same bus
+    I2CDevice* p_next;
+
+    // Take the bus and set it up for this device
+    bool acquire (void);
+
+    // Give the bus back and add the time it was held to the statistics
+    void release (uint32_t start);
+
+    friend class I2CBus;
+
+public:
+    // Create an object for a device on a managed bus
+    I2CDevice (I2CBus& bus, uint8_t address, const char* name,
+               uint32_t clock_hz = 100000, uint16_t timeout_ms = 10);
+
+    // Read a block of registers from the device
+    bool read (uint8_t reg, uint8_t* p_data, uint8_t length);
+
+    // Write a block of registers in the device
+    bool write (uint8_t reg, const uint8_t* p_data, uint8_t length);
+
+    // Write one register in the device
+    bool write (uint8_t reg, uint8_t value);
+
+    // Check whether the device answers its address
+    bool probe (void);
+
+    /** @brief   Get this device's bus statistics.
+     *  @returns A reference to the statistics structure
+     */
+    const I2CDeviceStats& get_stats (void) { return stats; }
+
+    /** @brief   Get the device's I2C address.
+     *  @returns The 7-bit address
+     */
+    uint8_t get_address (void) { return address; }
+};
+
+#endif // _I2C_BUS_MANAGER_H_
@@ -1,9 +1,16 @@
-/** @file main_i2c.cpp
- *    This file 
+/** @file main.cpp
+ *    This file contains a demonstration program in which two tasks read
+ *    BNO055 inertial measurement units which share one I2C bus. One task
+ *    reads the first IMU's fused orientation 100 times a second, in one
+ *    burst each time, and a sensor task, made from a block of settings,
+ *    reads the second IMU's accelerometer into a queue.
+ *    All traffic on the bus goes through an @c I2CBus manager, so the tasks
+ *    can run at full rate without their transactions colliding, and a third
+ *    task prints the orientation and how much of the bus each device uses.
  *
  *  @author  Matt Tagupa
  * 
- *  @date    
+ *  @date    18 Oct 2026 Share the bus through a bus manager
  */
 
 #include <Arduino.h>
@@ -13,95 +20,121 @@
 #endif
 
 #include <Wire.h>
-#include "BNO055_support.h"
-#include "BNO055.h"
-
-
-/** @brief   Scan the I2C bus and print a table of the devices which have been
- *           found.
- *  @details This function is modified from the example at
- *           @c https://playground.arduino.cc/Main/I2cScanner/. The printed
- *           symbols are:
- *           * @b - No device found at this I2C bus address
- *           * @b @@ No error; a device was found at this address
- *           * @b t The I2C bus timed out trying to read from this address
- *           * @b ? Unknown error when trying to find a device at this address
- *  @param   bus A reference to the I2C/Two-Wire bus to be scanned
- *  @param   printer A reference to the stream such as @c Serial on which the
- *           results of the scan are to be printed
- */
+#include "i2c_scan.h"
+#include "i2c_bus_manager.h"
+#include "bno055_accel.h"
+#include "bno055_fusion.h"
+#include "taskshare.h"
+#include "taskqueue.h"
+#include "sensor_task.h"
+
+/// The manager through which every task uses the I2C bus
+I2CBus i2c_bus (Wire);
+
+/// The first BNO055, with its ADR pin low
+I2CDevice imu_a (i2c_bus, 0x28, "IMU A", 400000);
+
+/// The first BNO055's fused orientation outputs
+BNO055FusionReader fusion_a (imu_a);
+
+/// The latest fused outputs from the first BNO055
+Share<BNO055Fusion> fusion_data ("Fusion");
 
+/// Readings from the second BNO055's accelerometer
+Queue<AccelFrame> frames_b (16, "IMU B", 0);
 
-void I2C_scan (TwoWire& bus, Stream& printer)
+/// Settings for the second BNO055, with its ADR pin high. Each further
+/// accelerometer needs only a block like this, a queue, and a task object
+const SensorTaskConfig imu_b_config =
+    {"IMU B", &i2c_bus, 0x29, 400000, 100, &frames_b, 4};
+
+/// The task which reads the second BNO055's accelerometer 100 times a second
+SensorTask<BNO055Accel> imu_b (imu_b_config);
+
+
+/** @brief   Task which shows readings from a sensor task's queue.
+ *  @details One reading in a hundred is printed, in g's. The queue doesn't
+ *           wait when it's read through @c Queue::get(), as it was made with
+ *           no wait so the sensor task never blocks on it; it's read through
+ *           its handle instead.
+ *  @param   p_params Pointer to the @c SensorTask whose readings are shown
+ */
+void task_show_readings (void* p_params)
 {
-    // Print a header for the table
-    printer << "    0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F" << hex 
-            << endl;
+    SensorTask<BNO055Accel>* p_task = (SensorTask<BNO055Accel>*)p_params;
+    Queue<AccelFrame>* p_frames = p_task->get_config ().p_output;
+    float g_per_count = p_task->get_sensor ().get_scale ();
 
-    for (uint8_t row = 0x00; row <= 0x70; row += 0x10)      // Rows are 16's
+    AccelFrame frame;
+    uint8_t count = 0;
+    for (;;)
     {
-        printer << row << " ";                              // Columns are 1's
-        for (uint8_t col = 0; col <= 0x0F; col++)
+        xQueueReceive (p_frames->get_handle (), &frame, portMAX_DELAY);
+        if (++count >= 100)
         {
-            if (row == 0 && col < 8)                        // Don't do these
-            {
-                printer << "   ";
-            }
-            else
-            {
-                bus.beginTransmission (row | col);
-                uint8_t error = bus.endTransmission ();
-                if (error == 0)                    printer << " @ ";
-                else if (error == 1)               printer << " t ";
-                else if (error == 2 or error == 3) printer << " - ";
-                else                               printer << " ? ";
-            }
+            count = 0;
+            Serial << p_task->get_config ().name << ": "
+                   << frame.x * g_per_count << " " << frame.y * g_per_count
+                   << " " << frame.z * g_per_count << endl;
         }
-        printer << endl;
     }
-    printer << dec;
 }
 
 
-/** @brief   Task which talks to an accelerometer periodically.
- *  @param   p_params Pointer to parameters passed to this function; we don't
- *           expect to be passed anything and so ignore this pointer
+/** @brief   Task which reads a BNO055's fused outputs 100 times a second.
+ *  @details Each reading is one 28 byte burst, converted to fixed-point
+ *           units with no floating point math, and is put in
+ *           @c fusion_data for other tasks to use.
+ *  @param   p_params Pointer to the @c BNO055FusionReader to be used
  */
-void task_accelerometer (void* p_params)
+void task_fusion (void* p_params)
 {
-    (void)p_params;
-
-    // Initialize the I2C bus and accelerometer driver
-    Wire.begin ();
-    BNO055_I2C_bus_read accel;                     // Create instance of the BNO055 class
+    BNO055FusionReader* p_reader = (BNO055FusionReader*)p_params;
 
-    // Run a scan and show where devices are found on the I2C bus
-    I2C_scan (Wire, Serial);
-
-    // Try to initialize the accelerometer; if it doesn't work, stop this task
-    if (accel.begin (Wire, 0x1D) == false)
+    // Try to start sensor fusion; if the IMU isn't there, stop this task
+    if (!p_reader->begin ())
     {
-        Serial.println ("No BNO055 has been found.");
+        Serial << "No BNO055 has been found for " << pcTaskGetName (NULL)
+               << endl;
         while (true)
         {
             vTaskDelay (10000);
         }
     }
 
-    // If the accelerometer does work, ask it for accelerations
+    TickType_t wake_time = xTaskGetTickCount ();
+    BNO055Fusion data;
     for (;;)
     {
-        vTaskDelay (5000);              // Wait a few seconds
-
-        if (accel.available ())         // If accelerometer data is ready
-        {
-            Serial.print (accel.getCalculatedX ());
-            Serial << " ";
-        }
-        else
+        if (p_reader->read (data))
         {
-            Serial << " - ";
+            fusion_data.put (data);
         }
+        vTaskDelayUntil (&wake_time, pdMS_TO_TICKS (10));
+    }
+}
+
+
+/** @brief   Task which prints the orientation and the bus manager's
+ *           statistics every few seconds.
+ *  @param   p_params Pointer to parameters passed to this function; we don't
+ *           expect to be passed anything and so ignore this pointer
+ */
+void task_bus_stats (void* p_params)
+{
+    (void)p_params;
+
+    for (;;)
+    {
+        vTaskDelay (5000);
+
+        BNO055Fusion data;
+        fusion_data.get (data);
+        Serial << "Heading " << data.euler[0] / 100.0f << " Roll "
+               << data.euler[1] / 100.0f << " Pitch " << data.euler[2] / 100.0f
+               << " Calibration 0x" << hex << data.calibration << dec << endl;
+        i2c_bus.print_stats (Serial);
+        SensorTaskBase::print_all (Serial);
     }
 }
 
@@ -120,25 +153,41 @@ void setup ()
     Serial << endl << endl << "\033[2JHello, I am a demonstration." << endl;
     Serial << "I will talk to an accelerometer through I2C." << endl << endl;
 
-    // Specify which pin is to be used to send the PWM and make a pointer to it
-    // The variable must be static so it exists when the task function runs
-    static uint8_t pin_for_PWM8 = PB8;
-    static uint8_t pin_for_PWM9 = PB9;
-
-    // Create a task which prints a slightly disagreeable message
-    xTaskCreate (task_accelerometer,
-                 "PWM Ramp",                      // Name for printouts
-                 200,                             // Stack size
-                 (void*)(&pin_for_PWM8),           // Parameter(s) for task fn.
+    // Start the bus once, here, rather than in each task, and show what's on
+    // it. A key pressed while the board was starting up asks for every
+    // address to be probed again
+    bool rescan = Serial.available () > 0;
+    while (Serial.available ())
+    {
+        Serial.read ();
+    }
+    i2c_bus.begin ();
+    I2C_scan (Wire, Serial, rescan);
+
+    // Create a task to read each IMU; both use the same bus at once
+    xTaskCreate (task_fusion,
+                 "IMU A",                         // Name for printouts
+                 512,                             // Stack size
+                 &fusion_a,                       // Parameter(s) for task fn.
                  4,                               // Priority
                  NULL);                           // Task handle
                  
-    // Create a task which prints a slightly disagreeable message
-    xTaskCreate (task_accelerometer,
-                 "PWM Ramp",                      // Name for printouts
-                 200,                             // Stack size
-                 (void*)(&pin_for_PWM9),           // Parameter(s) for task fn.
-                 4,                               // Priority
+    imu_b.start ();
+
+    // Create a task which shows some of the second IMU's readings
+    xTaskCreate (task_show_readings,
+                 "Show B",                        // Name for printouts
+                 512,                             // Stack size
+                 &imu_b,                          // Parameter(s) for task fn.
+                 2,                               // Priority
+                 NULL);                           // Task handle
+
+    // Create a task which shows which device uses the bus the most
+    xTaskCreate (task_bus_stats,
+                 "Stats",                         // Name for printouts
+                 512,                             // Stack size
+                 NULL,                            // Parameter(s) for task fn.
+                 1,                               // Priority
                  NULL);                           // Task handle
 
     // If using an STM32, we need to call the scheduler startup function now;
@@ -0,0 +1,102 @@
+/** @file sensor_task.cpp
+ *    This file contains source code for the parts of sensor tasks which are
+ *    the same for every type of sensor.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include <PrintStream.h>
+#include "sensor_task.h"
+
+
+/// The most recently made sensor task, the head of the list of them
+SensorTaskBase* SensorTaskBase::p_newest = NULL;
+
+
+/** @brief   Create the parts of a sensor task which don't depend on the sensor.
+ *  @details The sensor's @c I2CDevice is made from the settings, and the task
+ *           is added to the list of sensor tasks. Sensor tasks should be made
+ *           at startup, before the RTOS scheduler runs.
+ *  @param   config The settings, which must last as long as the task
+ */
+SensorTaskBase::SensorTaskBase (const SensorTaskConfig& config)
+    : p_config (&config),
+      device (*config.p_bus, config.address, config.name, config.clock_hz)
+{
+    handle = NULL;
+    stack_words = 0;
+    found = true;
+    readings = 0;
+    dropped = 0;
+    p_next = p_newest;
+    p_newest = this;
+}
+
+
+/** @brief   Create the RTOS task which runs this sensor.
+ *  @param   function The task function for this type of sensor
+ *  @param   stack_words The size of the task's stack in words
+ *  @returns True if the task was made, false if there wasn't memory
+ */
+bool SensorTaskBase::create (TaskFunction_t function, uint16_t stack_words)
+{
+    this->stack_words = stack_words;
+    return xTaskCreate (function, p_config->name, stack_words, this,
+                        p_config->priority, &handle) == pdPASS;
+}
+
+
+/** @brief   Put a batch of readings into the output queue.
+ *  @details Readings which don't fit are counted and thrown away, so a slow
+ *           consumer can't make the sensor miss its sample times.
+ *  @param   p_frames The readings
+ *  @param   count The number of readings
+ */
+void SensorTaskBase::publish (const AccelFrame* p_frames, uint16_t count)
+{
+    for (uint16_t index = 0; index < count; index++)
+    {
+        if (p_config->p_output->put (p_frames[index]))
+        {
+            readings++;
+        }
+        else
+        {
+            dropped++;
+        }
+    }
+}
+
+
+/** @brief   Print each sensor task's readings, losses and stack use.
+ *  @details Stack use is found from the RTOS's high water mark, so it's the
+ *           most the task has used since it started. If a task comes close
+ *           to its stack size, @c SENSOR_TASK_BASE_STACK should be raised.
+ *  @param   printer The serial device, such as @c Serial, on which to print
+ */
+void SensorTaskBase::print_all (Print& printer)
+{
+    printer << "Sensor   Readings  Dropped  Stack used/size" << endl;
+    for (SensorTaskBase* p_task = p_newest; p_task != NULL;
+         p_task = p_task->p_next)
+    {
+        printer << p_task->p_config->name << "\t ";
+        if (p_task->handle == NULL)
+        {
+            printer << "not started" << endl;
+        }
+        else if (!p_task->found)
+        {
+            printer << "missing" << endl;
+        }
+        else
+        {
+            uint16_t unused = uxTaskGetStackHighWaterMark (p_task->handle);
+            printer << p_task->readings << "  " << p_task->dropped << "  "
+                    << p_task->stack_words - unused << "/"
+                    << p_task->stack_words << endl;
+        }
+    }
+}
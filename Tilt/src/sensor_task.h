@@ -0,0 +1,212 @@
+/** @file sensor_task.h
+ *    This file contains a template for tasks which read sensors. Each sensor
+ *    is described by a small configuration block which gives its bus,
+ *    address, data rate, and output queue; one copy of the task code serves
+ *    every sensor of a type, and the stack size is worked out in one place,
+ *    from the frame buffer and an estimate of everything else the task uses,
+ *    rather than guessed for each @c xTaskCreate() call.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _SENSOR_TASK_H_
+#define _SENSOR_TASK_H_
+
+#include <Arduino.h>
+#if (defined STM32L4xx || defined STM32F4xx)
+    #include <STM32FreeRTOS.h>
+#endif
+#include "accelerometer.h"
+#include "i2c_bus_manager.h"
+#include "taskqueue.h"
+
+
+/// Number of frames a sensor task asks its sensor for at once
+const uint16_t SENSOR_TASK_BATCH = 8;
+
+/// Stack, in words, which a sensor task needs besides its frame buffer: the
+/// RTOS's task switch (50 words with the FPU's registers), the sensor's calls
+/// into the bus manager, and the @c Wire library. This is an estimate which
+/// has not yet been measured on a board. To measure it, start a
+/// @c BNO055Accel task with a large stack such as @c start(1000), let it run
+/// for a minute, and call @c SensorTaskBase::print_all(), which shows the
+/// words used as found by @c uxTaskGetStackHighWaterMark(); this constant
+/// should then be that figure less @c FRAME_WORDS, with the figure noted here
+const uint16_t SENSOR_TASK_BASE_STACK = 200;
+
+/// Extra stack, as a fraction of the need, kept for safety (1/4)
+const uint8_t SENSOR_TASK_MARGIN_SHIFT = 2;
+
+
+/** @brief   Settings which make one sensor task different from another.
+ *  @details A program has one of these for each sensor, usually as a
+ *           @c const global, which must last as long as the task runs.
+ */
+struct SensorTaskConfig
+{
+    const char* name;                 ///< Name of the task and device
+    I2CBus* p_bus;                    ///< The bus which the sensor is on
+    uint8_t address;                  ///< The sensor's I2C address
+    uint32_t clock_hz;                ///< Bus clock speed for this sensor
+    uint16_t rate_hz;                 ///< Readings to be taken each second
+    Queue<AccelFrame>* p_output;      ///< The queue for the readings
+    UBaseType_t priority;             ///< RTOS priority of the task
+};
+
+
+/** @brief   The parts of a sensor task which don't depend on the sensor.
+ *  @details This class keeps a list of all sensor tasks so that their
+ *           statistics, including how much stack each has used, can be
+ *           printed together.
+ */
+class SensorTaskBase
+{
+protected:
+    /// The settings for this task
+    const SensorTaskConfig* p_config;
+
+    /// The sensor's connection to the managed bus
+    I2CDevice device;
+
+    /// The RTOS task, once it has been started
+    TaskHandle_t handle;
+
+    /// The size of the task's stack in words
+    uint16_t stack_words;
+
+    /// False if the sensor didn't answer when the task started
+    bool found;
+
+    /// Number of readings put into the output queue
+    uint32_t readings;
+
+    /// Number of readings lost because the output queue was full
+    uint32_t dropped;
+
+    /// The sensor task made before this one
+    SensorTaskBase* p_next;
+
+    /// The most recently made sensor task, the head of the list
+    static SensorTaskBase* p_newest;
+
+    // Create the RTOS task which runs this sensor
+    bool create (TaskFunction_t function, uint16_t stack_words);
+
+    // Put a batch of readings into the output queue
+    void publish (const AccelFrame* p_frames, uint16_t count);
+
+public:
+    // Create the parts of a sensor task which don't depend on the sensor
+    SensorTaskBase (const SensorTaskConfig& config);
+
+    // Print each sensor task's readings, losses and stack use
+    static void print_all (Print& printer);
+
+    /// Return the settings for this task
+    const SensorTaskConfig& get_config (void) { return *p_config; }
+};
+
+
+/** @brief   Task which reads one sensor of a given type into a queue.
+ *  @details The sensor type is a template parameter, so the sensor's
+ *           methods are called directly rather than through virtual calls,
+ *           and one copy of this code runs every sensor of the same type.
+ *           The sensor class must have a constructor which takes an
+ *           @c I2CDevice and a rate in Hz, along with @c begin() and
+ *           @c read_frames() as in @c IAccelerometer. For example:
+ *           @code
+ *           Queue<AccelFrame> frames_b (16, "IMU B", 0);
+ *           const SensorTaskConfig imu_b_config =
+ *               {"IMU B", &i2c_bus, 0x29, 400000, 100, &frames_b, 4};
+ *           SensorTask<BNO055Accel> imu_b (imu_b_config);
+ *           ...
+ *           imu_b.start ();                   // In setup()
+ *           @endcode
+ */
+template <class Sensor> class SensorTask : public SensorTaskBase
+{
+protected:
+    /// The sensor which this task reads
+    Sensor sensor;
+
+    // The RTOS task function, which runs the task's loop
+    static void run (void* p_params);
+
+    // Start the sensor, then read it and pass on readings forever
+    void loop (void);
+
+public:
+    /// Stack in words taken by the frame buffer in @c loop()
+    static const uint16_t FRAME_WORDS
+        = (SENSOR_TASK_BATCH * sizeof (AccelFrame) + sizeof (StackType_t) - 1)
+          / sizeof (StackType_t);
+
+    /// Stack in words which this task needs, with a safety margin
+    static const uint16_t STACK_WORDS
+        = SENSOR_TASK_BASE_STACK + FRAME_WORDS
+          + ((SENSOR_TASK_BASE_STACK + FRAME_WORDS) >> SENSOR_TASK_MARGIN_SHIFT);
+
+    /** @brief   Create a sensor task from its settings.
+     *  @param   config The settings, which must last as long as the task
+     */
+    SensorTask (const SensorTaskConfig& config)
+        : SensorTaskBase (config), sensor (device, config.rate_hz)
+    {
+    }
+
+    /** @brief   Start the task.
+     *  @param   stack_words The stack size in words, or 0 to use
+     *           @c STACK_WORDS, which is almost always right
+     *  @returns True if the task was made, false if there wasn't memory
+     */
+    bool start (uint16_t stack_words = 0)
+    {
+        if (stack_words == 0)
+        {
+            stack_words = STACK_WORDS;
+        }
+        return create (run, stack_words);
+    }
+
+    /** @brief   Get the sensor which this task reads.
+     *  @returns A reference to the sensor, whose scale and rate can be used
+     *           by tasks which take its readings
+     */
+    Sensor& get_sensor (void) { return sensor; }
+};
+
+
+/** @brief   The RTOS task function for every sensor task of one type.
+ *  @param   p_params Pointer to the @c SensorTask being run
+ */
+template <class Sensor>
+void SensorTask<Sensor>::run (void* p_params)
+{
+    ((SensorTask<Sensor>*)p_params)->loop ();
+}
+
+
+/** @brief   Start the sensor, then read it and pass on readings forever.
+ *  @details If the sensor doesn't answer, the task waits forever, and
+ *           @c print_all() shows it as missing.
+ */
+template <class Sensor>
+void SensorTask<Sensor>::loop (void)
+{
+    found = sensor.begin ();
+    while (!found)
+    {
+        vTaskDelay (10000);
+    }
+
+    AccelFrame frames[SENSOR_TASK_BATCH];
+    for (;;)
+    {
+        uint16_t count = sensor.read_frames (frames, SENSOR_TASK_BATCH);
+        publish (frames, count);
+    }
+}
+
+#endif // _SENSOR_TASK_H_
@@ -0,0 +1,124 @@
+/** @file Arduino.h
+ *    This file stands in for the Arduino core when the web server is built
+ *    on a PC for load testing. Only the few parts of the core which the web
+ *    server and response writer use are here: @c Print, the clocks, and the
+ *    flash string functions, which are ordinary string functions on a PC.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+
+/// Strings are in ordinary memory on a PC
+#define PROGMEM
+
+/// A pointer to a string in flash, which is an ordinary pointer on a PC
+typedef const char* PGM_P;
+
+#define strlen_P strlen
+#define memcpy_P memcpy
+
+
+/** @brief   Return the time since some moment in microseconds.
+ */
+inline uint32_t micros (void)
+{
+    struct timespec now;
+    clock_gettime (CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+}
+
+
+/** @brief   Return the time since some moment in milliseconds.
+ */
+inline uint32_t millis (void)
+{
+    struct timespec now;
+    clock_gettime (CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000ULL + now.tv_nsec / 1000000);
+}
+
+
+/** @brief   A device to which text can be printed, as in the Arduino core.
+ */
+class Print
+{
+public:
+    /// Write one character; this is what descendents must provide
+    virtual size_t write (uint8_t character) = 0;
+
+    /// Write a block of characters one at a time
+    virtual size_t write (const uint8_t* p_data, size_t size)
+    {
+        size_t count = 0;
+        while (size--)
+        {
+            count += write (*p_data++);
+        }
+        return count;
+    }
+
+    /// Write a string
+    size_t write (const char* p_text)
+    {
+        return write ((const uint8_t*)p_text, strlen (p_text));
+    }
+
+    size_t print (const char* p_text) { return write (p_text); }
+    size_t print (char character) { return write ((uint8_t)character); }
+    size_t print (long number) { return print_format ("%ld", number); }
+    size_t print (int number) { return print ((long)number); }
+    size_t print (unsigned long number)
+    {
+        return print_format ("%lu", number);
+    }
+    size_t print (unsigned int number) { return print ((unsigned long)number); }
+    size_t print (unsigned char number)
+    {
+        return print ((unsigned long)number);
+    }
+    size_t print (double number, int digits = 2)
+    {
+        char text[32];
+        snprintf (text, sizeof (text), "%.*f", digits, number);
+        return write (text);
+    }
+
+    virtual ~Print () { }
+
+protected:
+    /// Print one number with a @c printf() format
+    template <class Number> size_t print_format (const char* format,
+                                                 Number number)
+    {
+        char text[24];
+        snprintf (text, sizeof (text), format, number);
+        return write (text);
+    }
+};
+
+
+/** @brief   Standard output, which stands in for the serial port.
+ */
+class HostSerial : public Print
+{
+public:
+    size_t write (uint8_t character) { return putchar (character) != EOF; }
+    using Print::write;
+};
+
+/// The one standard output
+static HostSerial Serial;
+
+#endif // _HOST_ARDUINO_H_
@@ -0,0 +1,38 @@
+/** @file PrintStream.h
+ *    This file stands in for the PrintStream library when the web server is
+ *    built on a PC, so that the @c << operator can be used with @c Print.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _HOST_PRINTSTREAM_H_
+#define _HOST_PRINTSTREAM_H_
+
+#include "Arduino.h"
+
+
+/// The end of a line, as in @c Serial @c << @c endl
+enum _EndLineCode { endl };
+
+
+/** @brief   Print the end of a line.
+ */
+inline Print& operator << (Print& printer, _EndLineCode)
+{
+    printer.print ("\n");
+    return printer;
+}
+
+
+/** @brief   Print anything which @c Print::print() can print.
+ */
+template <class Item> inline Print& operator << (Print& printer,
+                                                 const Item& item)
+{
+    printer.print (item);
+    return printer;
+}
+
+#endif // _HOST_PRINTSTREAM_H_
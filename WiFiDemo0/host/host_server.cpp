@@ -0,0 +1,90 @@
+/** @file host_server.cpp
+ *    This file runs the ESP32 program's web server on a PC, so that it can be
+ *    load tested without a board. The server code is the same as on the
+ *    ESP32, as are the static pages in @c web ; the other pages are
+ *    different, as the PC has no shares or WiFi.
+ *    To build it and run it on port 8080, from the @c WiFiDemo0 directory:
+ *    @code
+ *    g++ -O2 -I host -o host_server host/host_server.cpp \
+ *        src/http_server.cpp src/response_writer.cpp src/web_assets.cpp \
+ *        src/web_assets_data.cpp
+ *    ./host_server 8080
+ *    @endcode
+ *    Then load it with @c host/load_test.cpp or any HTTP load tester. The
+ *    server prints its request rate and latency every five seconds.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include <PrintStream.h>
+#include "../src/http_server.h"
+#include "../src/response_writer.h"
+#include "../src/web_assets.h"
+
+
+/// A page about as big as the ESP32's main page, sent in chunks
+const char TEST_PAGE_HEAD[] PROGMEM =
+    "<!DOCTYPE html><html><head><title>Host Test</title></head><body>\n"
+    "<h1>Web Server Load Test</h1>\n";
+
+
+/** @brief   Send a page made the same way as the ESP32's pages.
+ *  @param   request The request which is being answered
+ */
+void handle_page (HttpRequest& request)
+{
+    ResponseWriter page (request);
+    page.begin (200, "text/html");
+    page.put_P (TEST_PAGE_HEAD);
+    for (uint8_t line = 0; line < 10; line++)
+    {
+        page << "<p>Line " << line << ": " << millis () << " ms</p>\n";
+    }
+    page.print ("</body></html>\n");
+    page.end ();
+}
+
+
+/** @brief   Send a tiny response, to measure the server's own overhead.
+ *  @param   request The request which is being answered
+ */
+void handle_hello (HttpRequest& request)
+{
+    request.send (200, "text/plain", "Hello\n");
+}
+
+
+/** @brief   Run the web server on a PC until it's stopped.
+ *  @param   argc The number of command line arguments
+ *  @param   argv The arguments; the first, if given, is the port number
+ *  @returns Only returns, with 1, if the server can't be started
+ */
+int main (int argc, char** argv)
+{
+    uint16_t port = (argc > 1) ? atoi (argv[1]) : 8080;
+    HttpServer server (port);
+
+    add_asset_routes (server);
+    server.on ("/chunked", handle_page);
+    server.on ("/hello", handle_hello);
+    if (!server.begin ())
+    {
+        Serial << "Can't listen on port " << port << endl;
+        return 1;
+    }
+    Serial << "Listening on port " << port << endl;
+
+    uint32_t status_time = millis ();
+    for (;;)
+    {
+        server.run_once (1000);
+        if (millis () - status_time >= 5000)
+        {
+            status_time = millis ();
+            server.print_status (Serial);
+            fflush (stdout);
+        }
+    }
+}
@@ -0,0 +1,262 @@
+/** @file load_test.cpp
+ *    This file contains a small load tester for the web server. It opens a
+ *    number of connections, each in its own thread, and on each one asks for
+ *    a page over and over for a while, keeping the connection open between
+ *    requests as a browser does. Then it prints the number of requests
+ *    answered each second and the latency seen by the clients. It can test
+ *    the server running on a PC (see @c host_server.cpp ) or on the ESP32.
+ *    To build and run it, from the @c WiFiDemo0 directory:
+ *    @code
+ *    g++ -O2 -pthread -o load_test host/load_test.cpp
+ *    ./load_test 127.0.0.1 8080 /hello 4 10
+ *    @endcode
+ *    The arguments are the server's address, its port, the page, the number
+ *    of connections, the test's length in seconds, and optionally one more
+ *    header line to send, such as @c "If-None-Match: \"...\"" to test
+ *    cached pages.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+
+/// Settings and results for one connection's thread
+struct LoadClient
+{
+    const char* address;              ///< The server's IP address
+    uint16_t port;                    ///< The server's port
+    const char* path;                 ///< The page which is asked for
+    const char* header;               ///< Another header line, or ""
+    double seconds;                   ///< How long to keep asking
+    uint32_t requests;                ///< Responses received
+    uint32_t errors;                  ///< Failed requests and connections
+    double latency_total;             ///< Total latency, in seconds
+    double latency_max;               ///< Longest latency, in seconds
+};
+
+
+/** @brief   Return the time in seconds since some moment.
+ */
+static double now (void)
+{
+    struct timespec time;
+    clock_gettime (CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+
+/** @brief   Open a connection to the server.
+ *  @param   p_client The settings for the connection
+ *  @returns The socket, or -1 if the server couldn't be reached
+ */
+static int open_connection (LoadClient* p_client)
+{
+    int socket = ::socket (AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in server;
+    memset (&server, 0, sizeof (server));
+    server.sin_family = AF_INET;
+    server.sin_port = htons (p_client->port);
+    inet_pton (AF_INET, p_client->address, &server.sin_addr);
+    if (connect (socket, (struct sockaddr*)&server, sizeof (server)) < 0)
+    {
+        close (socket);
+        return -1;
+    }
+    int one = 1;
+    setsockopt (socket, IPPROTO_TCP, TCP_NODELAY, &one, sizeof (one));
+    return socket;
+}
+
+
+/** @brief   Read one response, whether it has a length or comes in chunks.
+ *  @param   socket The connection
+ *  @param   p_closes Set true if the server will close the connection
+ *  @returns The response's status code, such as 200, or 0 if the connection
+ *           broke before a whole response arrived
+ */
+static int read_response (int socket, bool* p_closes)
+{
+    static const size_t SIZE = 16384;
+    char buffer[SIZE + 1];
+    size_t received = 0;
+    char* p_body = NULL;
+    long length = -1;
+    int status = 0;
+    for (;;)
+    {
+        ssize_t got = recv (socket, buffer + received, SIZE - received, 0);
+        if (got <= 0)
+        {
+            // A response without length or chunks ends when the server closes
+            return (p_body != NULL && length < 0 && *p_closes) ? status : 0;
+        }
+        received += got;
+        buffer[received] = '\0';
+
+        if (p_body == NULL)
+        {
+            char* p_blank = strstr (buffer, "\r\n\r\n");
+            if (p_blank == NULL)
+            {
+                continue;
+            }
+            p_body = p_blank + 4;
+            status = atoi (buffer + 9);     // After "HTTP/1.1 "
+            *p_closes = (strcasestr (buffer, "Connection: close") != NULL);
+            if (status == 204 || status == 304)
+            {
+                return status;              // These never have content
+            }
+            char* p_length = strcasestr (buffer, "Content-Length:");
+            if (p_length != NULL && p_length < p_body)
+            {
+                length = atol (p_length + 15);
+            }
+        }
+        if (length >= 0 && buffer + received >= p_body + length)
+        {
+            return status;
+        }
+        if (length < 0 && strstr (p_body, "\r\n0\r\n\r\n") != NULL)
+        {
+            return status;
+        }
+        if (received >= SIZE)
+        {
+            return 0;                       // Too big for this simple tester
+        }
+    }
+}
+
+
+/** @brief   Ask for a page over and over on one connection.
+ *  @param   p_params Pointer to the @c LoadClient for this thread
+ *  @returns @c NULL
+ */
+static void* run_client (void* p_params)
+{
+    LoadClient* p_client = (LoadClient*)p_params;
+    char request[256];
+    int length = snprintf (request, sizeof (request),
+                           "GET %s HTTP/1.1\r\nHost: %s\r\n"
+                           "Accept-Encoding: gzip\r\n%s%s\r\n",
+                           p_client->path, p_client->address,
+                           p_client->header,
+                           *p_client->header ? "\r\n" : "");
+
+    double stop_time = now () + p_client->seconds;
+    int socket = -1;
+    while (now () < stop_time)
+    {
+        if (socket < 0 && (socket = open_connection (p_client)) < 0)
+        {
+            p_client->errors++;
+            usleep (10000);
+            continue;
+        }
+
+        double start = now ();
+        bool closes = false;
+        int status = 0;
+        if (send (socket, request, length, MSG_NOSIGNAL) == length)
+        {
+            status = read_response (socket, &closes);
+        }
+        if ((status < 200 || status > 299) && status != 304)
+        {
+            // A busy server answers 503 and closes, so wait a moment
+            p_client->errors++;
+            close (socket);
+            socket = -1;
+            usleep (status ? 10000 : 0);
+            continue;
+        }
+        double latency = now () - start;
+        p_client->requests++;
+        p_client->latency_total += latency;
+        if (latency > p_client->latency_max)
+        {
+            p_client->latency_max = latency;
+        }
+        if (closes)
+        {
+            close (socket);
+            socket = -1;
+        }
+    }
+    if (socket >= 0)
+    {
+        close (socket);
+    }
+    return NULL;
+}
+
+
+/** @brief   Run the load test and print the results.
+ *  @param   argc The number of command line arguments
+ *  @param   argv Address, port, page, connections, seconds, and header
+ *  @returns 0 if any requests were answered, 1 if not
+ */
+int main (int argc, char** argv)
+{
+    const char* address = (argc > 1) ? argv[1] : "127.0.0.1";
+    uint16_t port = (argc > 2) ? atoi (argv[2]) : 8080;
+    const char* path = (argc > 3) ? argv[3] : "/";
+    int connections = (argc > 4) ? atoi (argv[4]) : 4;
+    double seconds = (argc > 5) ? atof (argv[5]) : 10.0;
+    const char* header = (argc > 6) ? argv[6] : "";
+
+    LoadClient* clients = (LoadClient*)calloc (connections,
+                                               sizeof (LoadClient));
+    pthread_t* threads = (pthread_t*)calloc (connections, sizeof (pthread_t));
+    for (int index = 0; index < connections; index++)
+    {
+        clients[index].address = address;
+        clients[index].port = port;
+        clients[index].path = path;
+        clients[index].header = header;
+        clients[index].seconds = seconds;
+        pthread_create (threads + index, NULL, run_client, clients + index);
+    }
+
+    uint32_t requests = 0;
+    uint32_t errors = 0;
+    double latency_total = 0.0;
+    double latency_max = 0.0;
+    for (int index = 0; index < connections; index++)
+    {
+        pthread_join (threads[index], NULL);
+        requests += clients[index].requests;
+        errors += clients[index].errors;
+        latency_total += clients[index].latency_total;
+        if (clients[index].latency_max > latency_max)
+        {
+            latency_max = clients[index].latency_max;
+        }
+    }
+
+    printf ("%s:%u%s, %d connections, %.1f s\n", address, port, path,
+            connections, seconds);
+    printf ("%u requests, %.1f requests/s, %u errors\n", requests,
+            requests / seconds, errors);
+    if (requests)
+    {
+        printf ("Latency %.3f ms average, %.3f ms most\n",
+                latency_total / requests * 1000.0, latency_max * 1000.0);
+    }
+    free (clients);
+    free (threads);
+    return requests ? 0 : 1;
+}
@@ -0,0 +1,368 @@
+//*****************************************************************************
+/** @file    baseshare.cpp
+ *  @brief   Source code of a base class for type-safe, thread-safe task data 
+ *           exchange classes.
+ *  @details This file contains a base class for classes which exchange data 
+ *           between tasks. Inter-task data must be exchanged in a thread-safe
+ *           manner, so the classes which share the data use mutexes or mutual 
+ *           exclusion mechanisms to prevent corruption of data. A linked list
+ *           of all inter-task data items is kept by the system, and this base
+ *           class contains members that handle that linked list. 
+ *
+ *  @date 2014-Oct-18 JRR Created file
+ *  @date 2020-Oct-19 JRR Modified for use with Arduino/FreeRTOS platform
+ *
+ *  License:
+ *    This file is copyright 2014 - 2020 by JR Ridgely and released under the
+ *    Lesser GNU Public License, version 2. It intended for educational use 
+ *    only, but its use is not limited thereto. */
+/*    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *    IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *    THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+ *    PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIB-
+ *    UTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+ *    OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN 
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ *    THE POSSIBILITY OF SUCH DAMAGE. */
+//*****************************************************************************
+
+#include <limits.h>
+#include <errno.h>
+#include <math.h>
+#include "baseshare.h"                      // Header for the base share class
+
+
+// Set pointer to most recently created shared data item to initially be NULL
+BaseShare* BaseShare::p_newest = NULL;
+
+// The spinlock which guards shared data items' critical sections on an ESP32
+#ifdef ESP32
+    portMUX_TYPE share_mux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+
+/** @brief   Construct a base shared data item.
+ *  @details This default constructor saves the name of the shared data item. 
+ *           It is not to be called by application code (nobody has any reason 
+ *           to create a base class object which can't do anything!) but 
+ *           instead by the constructors of descendent classes. 
+ *  @param   p_name The name for the shared data item, in a character string
+ */
+BaseShare::BaseShare (const char* p_name)
+{
+    // Allocate some memory and save the share's name; trim it to 12 characters
+    if (p_name != NULL)
+    {
+        uint8_t namelength = strlen (p_name);
+        namelength = (namelength <= 15) ? namelength : 15;
+        strncpy (name, p_name, namelength);
+        name[namelength] = '\0';
+    }
+    else
+    {
+        strcpy (name, "(No Name)");
+    }
+
+    // Values can't be changed from outside the program unless allowed
+    writable = false;
+
+    // Install this share in the linked list of shares
+    p_next = p_newest;
+    p_newest = this;
+}
+
+
+/** @brief   Start the printout showing the status of all shared data items.
+ *  @details This method begins printing out the status of all items in the 
+ *           system's linked list of shared data items (queues, task shares, 
+ *           and so on). The most recently created share's status is printed
+ *           first, followed by the status of other shares in reverse order of
+ *           creation. 
+ *  @param   printer Pointer to a serial device on which to print
+ */
+void print_all_shares (Print& printer)
+{
+    printer.println ("Share/Queue     Type    Max. Full");
+    printer.println ("-----------     ----    ---------");
+
+    BaseShare::p_newest->print_in_list (printer);
+}
+
+
+/** @brief   Print true or false as a JSON value.
+ *  @param   printer The device on which to print the value
+ *  @param   value The value
+ */
+void share_print_json (Print& printer, bool value)
+{
+    printer.print (value ? "true" : "false");
+}
+
+/// Print a small signed number as a JSON value
+void share_print_json (Print& printer, signed char value)
+{
+    printer.print ((long)value);
+}
+
+/// Print a small unsigned number as a JSON value
+void share_print_json (Print& printer, unsigned char value)
+{
+    printer.print ((unsigned long)value);
+}
+
+/// Print a short signed number as a JSON value
+void share_print_json (Print& printer, short value)
+{
+    printer.print ((long)value);
+}
+
+/// Print a short unsigned number as a JSON value
+void share_print_json (Print& printer, unsigned short value)
+{
+    printer.print ((unsigned long)value);
+}
+
+/// Print a signed number as a JSON value
+void share_print_json (Print& printer, int value)
+{
+    printer.print ((long)value);
+}
+
+/// Print an unsigned number as a JSON value
+void share_print_json (Print& printer, unsigned int value)
+{
+    printer.print ((unsigned long)value);
+}
+
+/// Print a long signed number as a JSON value
+void share_print_json (Print& printer, long value)
+{
+    printer.print (value);
+}
+
+/// Print a long unsigned number as a JSON value
+void share_print_json (Print& printer, unsigned long value)
+{
+    printer.print (value);
+}
+
+
+/** @brief   Print a floating point number as a JSON value.
+ *  @details JSON can't hold infinity or not-a-number, so these are printed
+ *           as @c null .
+ *  @param   printer The device on which to print the value
+ *  @param   value The value
+ */
+void share_print_json (Print& printer, float value)
+{
+    share_print_json (printer, (double)value);
+}
+
+/// Print a double precision number as a JSON value, or null if it isn't one
+void share_print_json (Print& printer, double value)
+{
+    if (isnan (value) || isinf (value))
+    {
+        printer.print ("null");
+    }
+    else
+    {
+        printer.print (value, 4);
+    }
+}
+
+
+/** @brief   Read a whole number from text, checking its range.
+ *  @param   p_text The text, which may have spaces around the number
+ *  @param   value Where the number is put
+ *  @param   lowest The smallest number allowed
+ *  @param   highest The largest number allowed
+ *  @returns True if the text was a number in range, false if not
+ */
+static bool parse_long (const char* p_text, long& value, long lowest,
+                        long highest)
+{
+    char* p_end;
+    errno = 0;
+    long number = strtol (p_text, &p_end, 10);
+    while (*p_end == ' ' || *p_end == '\r' || *p_end == '\n')
+    {
+        p_end++;
+    }
+    if (p_end == p_text || *p_end || errno || number < lowest
+        || number > highest)
+    {
+        return false;
+    }
+    value = number;
+    return true;
+}
+
+
+/** @brief   Read a whole number which can't be negative from text.
+ *  @param   p_text The text, which may have spaces around the number
+ *  @param   value Where the number is put
+ *  @param   highest The largest number allowed
+ *  @returns True if the text was a number in range, false if not
+ */
+static bool parse_unsigned (const char* p_text, unsigned long& value,
+                            unsigned long highest)
+{
+    char* p_end;
+    while (*p_text == ' ')
+    {
+        p_text++;
+    }
+    errno = 0;
+    unsigned long number = strtoul (p_text, &p_end, 10);
+    while (*p_end == ' ' || *p_end == '\r' || *p_end == '\n')
+    {
+        p_end++;
+    }
+    if (p_end == p_text || *p_text == '-' || *p_end || errno
+        || number > highest)
+    {
+        return false;
+    }
+    value = number;
+    return true;
+}
+
+
+/** @brief   Read true or false, or 1 or 0, from text.
+ *  @details The word must be the whole text apart from spaces around it, so
+ *           "10" and "truex" are refused rather than read as true.
+ *  @param   p_text The text, which may have spaces around the word
+ *  @param   value Where the value is put
+ *  @returns True if the text made sense, false if not
+ */
+bool share_parse_text (const char* p_text, bool& value)
+{
+    while (*p_text == ' ')
+    {
+        p_text++;
+    }
+    size_t length = strcspn (p_text, " \r\n");
+    const char* p_end = p_text + length;
+    while (*p_end == ' ' || *p_end == '\r' || *p_end == '\n')
+    {
+        p_end++;
+    }
+    if (*p_end)
+    {
+        return false;
+    }
+    if ((length == 4 && strncmp (p_text, "true", 4) == 0)
+        || (length == 1 && *p_text == '1'))
+    {
+        value = true;
+        return true;
+    }
+    if ((length == 5 && strncmp (p_text, "false", 5) == 0)
+        || (length == 1 && *p_text == '0'))
+    {
+        value = false;
+        return true;
+    }
+    return false;
+}
+
+/// Read a small signed number from text
+bool share_parse_text (const char* p_text, signed char& value)
+{
+    long number;
+    bool ok = parse_long (p_text, number, SCHAR_MIN, SCHAR_MAX);
+    value = ok ? number : value;
+    return ok;
+}
+
+/// Read a small unsigned number from text
+bool share_parse_text (const char* p_text, unsigned char& value)
+{
+    unsigned long number;
+    bool ok = parse_unsigned (p_text, number, UCHAR_MAX);
+    value = ok ? number : value;
+    return ok;
+}
+
+/// Read a short signed number from text
+bool share_parse_text (const char* p_text, short& value)
+{
+    long number;
+    bool ok = parse_long (p_text, number, SHRT_MIN, SHRT_MAX);
+    value = ok ? number : value;
+    return ok;
+}
+
+/// Read a short unsigned number from text
+bool share_parse_text (const char* p_text, unsigned short& value)
+{
+    unsigned long number;
+    bool ok = parse_unsigned (p_text, number, USHRT_MAX);
+    value = ok ? number : value;
+    return ok;
+}
+
+/// Read a signed number from text
+bool share_parse_text (const char* p_text, int& value)
+{
+    long number;
+    bool ok = parse_long (p_text, number, INT_MIN, INT_MAX);
+    value = ok ? number : value;
+    return ok;
+}
+
+/// Read an unsigned number from text
+bool share_parse_text (const char* p_text, unsigned int& value)
+{
+    unsigned long number;
+    bool ok = parse_unsigned (p_text, number, UINT_MAX);
+    value = ok ? number : value;
+    return ok;
+}
+
+/// Read a long signed number from text
+bool share_parse_text (const char* p_text, long& value)
+{
+    return parse_long (p_text, value, LONG_MIN, LONG_MAX);
+}
+
+/// Read a long unsigned number from text
+bool share_parse_text (const char* p_text, unsigned long& value)
+{
+    return parse_unsigned (p_text, value, ULONG_MAX);
+}
+
+
+/** @brief   Read a floating point number from text.
+ *  @param   p_text The text, which may have spaces around the number
+ *  @param   value Where the number is put
+ *  @returns True if the text was a number, false if not
+ */
+bool share_parse_text (const char* p_text, double& value)
+{
+    char* p_end;
+    double number = strtod (p_text, &p_end);
+    while (*p_end == ' ' || *p_end == '\r' || *p_end == '\n')
+    {
+        p_end++;
+    }
+    if (p_end == p_text || *p_end || isnan (number) || isinf (number))
+    {
+        return false;
+    }
+    value = number;
+    return true;
+}
+
+/// Read a single precision floating point number from text
+bool share_parse_text (const char* p_text, float& value)
+{
+    double number;
+    bool ok = share_parse_text (p_text, number);
+    value = ok ? number : value;
+    return ok;
+}
@@ -0,0 +1,208 @@
+//*****************************************************************************
+/** @file    baseshare.h
+ *  @brief   Headers for a base class for type-safe, thread-safe task data 
+ *           exchange classes.
+ *  @details This file contains a base class for classes which exchange data 
+ *           between tasks. Inter-task data must be exchanged in a thread-safe 
+ *           manner, so the classes which share the data use mutexes or mutual 
+ *           exclusion mechanisms to prevent corruption of data. A linked list
+ *           of all inter-task data items is kept by this system, and this base
+ *           class contains members that handle that linked list. 
+ *
+ *  @date 2014-Oct-18 JRR Created file
+ *  @date 2020-Oct-19 JRR Modified for use with Arduino/FreeRTOS platform
+ *
+ *  License:
+ *    This file is copyright 2014 - 2020 by JR Ridgely and released under the
+ *    Lesser GNU Public License, version 2. It intended for educational use 
+ *    only, but its use is not limited thereto. */
+/*    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ *    IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *    THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+ *    PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIB-
+ *    UTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+ *    OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN 
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ *    THE POSSIBILITY OF SUCH DAMAGE. */
+//*****************************************************************************
+
+// This define prevents this .h file from being included more than once
+#ifndef _BASESHARE_H_
+#define _BASESHARE_H_
+
+#include <Arduino.h>
+
+
+/** @brief   Base class for classes that share data in a thread-safe manner 
+ *           between tasks.
+ *  @details This is a base class for classes which share data between tasks
+ *           without the risk of data corruption associated with global 
+ *           variables. Queues and task shares are two examples of such shared
+ *           data classes. 
+ */
+class BaseShare
+{
+    protected:
+        /** @brief   The name of the shared item.
+         *  @details This string holds the shared item's name. The name is only
+         *           used for identification on debugging printouts or logs.
+         */
+        char name[16];
+
+        /** @brief   Pointer to the next item in the linked list of shares.
+         *  @details This pointer points to the next item in the system's list
+         *           of shared data items (shares, queues, @e etc.) If this 
+         *           share is the most recently created one, the pointer will 
+         *           be @c NULL. The list goes backwards; the next item is the
+         *           previously created one.
+         */
+        BaseShare* p_next;
+
+        /** @brief   Pointer to the most recently created shared data item.
+         *  @details This @c static variable, one copy of which is shared by 
+         *           all shared data items, is a pointer to the most recently 
+         *           created one. It is used as the beginning of a linked list
+         *           of all shared data items in the system. 
+         */
+        static BaseShare* p_newest;
+
+        /// True if the item's value may be changed from outside the program,
+        /// such as through the web server
+        bool writable;
+
+    public:
+        // Construct a base shared data item
+        BaseShare (const char* p_name = NULL);
+
+        /// Return the shared item's name
+        const char* get_name (void) { return name; }
+
+        /// Return the shared item made before this one, or @c NULL
+        BaseShare* get_next (void) { return p_next; }
+
+        /// Return the most recently made shared item, the head of the list
+        static BaseShare* get_newest (void) { return p_newest; }
+
+        /// Allow, or stop, changes to the value from outside the program
+        void set_writable (bool allow = true) { writable = allow; }
+
+        /// Return true if the value may be changed from outside the program
+        bool is_writable (void) { return writable; }
+
+        /** @brief   Return the kind of shared item, "share" or "queue".
+         */
+        virtual const char* get_kind (void) = 0;
+
+        /** @brief   Return the number of bytes which @c snapshot() copies.
+         */
+        virtual size_t get_size (void) = 0;
+
+        /** @brief   Copy the item's value as bytes, without locking.
+         *  @details This is called inside a critical section, so that the
+         *           values of many items can be copied at the same moment; it
+         *           must be short and must not block.
+         *  @param   p_raw Where to put @c get_size() bytes
+         */
+        virtual void snapshot (void* p_raw) = 0;
+
+        /** @brief   Print a value which was copied by @c snapshot() as JSON.
+         *  @param   printer The device on which to print the value
+         *  @param   p_raw The bytes which @c snapshot() copied
+         */
+        virtual void print_json (Print& printer, const void* p_raw) = 0;
+
+        /** @brief   Set the value from text, such as "22.5" or "true".
+         *  @param   p_text The text
+         *  @returns True if the value was set, false if the item isn't
+         *           writable or the text didn't make sense for its type
+         */
+        virtual bool put_text (const char* p_text) = 0;
+
+        /** @brief   Set the value from bytes in the item's own format.
+         *  @param   p_data The bytes
+         *  @param   size The number of bytes, which must be the type's size
+         *  @returns True if the value was set, false if not
+         */
+        virtual bool put_bytes (const void* p_data, size_t size) = 0;
+
+        /** @brief   Print one shared data item within a list.
+         *  @details Make a printout showing the condition of this shared data
+         *           item, such as the value of a shared variable or how full a
+         *           queue's buffer is. This method must be overridden in each
+         *           descendent class with a method that actually @e does 
+         *           something. 
+         *  @param   printer Reference to a serial device on which to print 
+         */
+        virtual void print_in_list (Print& printer) = 0;
+
+        // }
+        friend void print_all_shares (Print& printer);
+};
+
+
+// Function that prints a list of shares and queues
+void print_all_shares (Print& printer);
+
+// Print numbers and true/false as JSON values
+void share_print_json (Print& printer, bool value);
+void share_print_json (Print& printer, signed char value);
+void share_print_json (Print& printer, unsigned char value);
+void share_print_json (Print& printer, short value);
+void share_print_json (Print& printer, unsigned short value);
+void share_print_json (Print& printer, int value);
+void share_print_json (Print& printer, unsigned int value);
+void share_print_json (Print& printer, long value);
+void share_print_json (Print& printer, unsigned long value);
+void share_print_json (Print& printer, float value);
+void share_print_json (Print& printer, double value);
+
+// Read numbers and true/false from text
+bool share_parse_text (const char* p_text, bool& value);
+bool share_parse_text (const char* p_text, signed char& value);
+bool share_parse_text (const char* p_text, unsigned char& value);
+bool share_parse_text (const char* p_text, short& value);
+bool share_parse_text (const char* p_text, unsigned short& value);
+bool share_parse_text (const char* p_text, int& value);
+bool share_parse_text (const char* p_text, unsigned int& value);
+bool share_parse_text (const char* p_text, long& value);
+bool share_parse_text (const char* p_text, unsigned long& value);
+bool share_parse_text (const char* p_text, float& value);
+bool share_parse_text (const char* p_text, double& value);
+
+
+/** @brief   Print a value of a type which isn't a number as JSON.
+ *  @details Structures and other types are printed as a string of the hex
+ *           digits of their bytes.
+ *  @param   printer The device on which to print the value
+ *  @param   value The value
+ */
+template <class DataType>
+void share_print_json (Print& printer, const DataType& value)
+{
+    const uint8_t* p_byte = (const uint8_t*)&value;
+    printer.print ('"');
+    for (size_t index = 0; index < sizeof (DataType); index++)
+    {
+        printer.print ("0123456789abcdef"[p_byte[index] >> 4]);
+        printer.print ("0123456789abcdef"[p_byte[index] & 0x0F]);
+    }
+    printer.print ('"');
+}
+
+
+/** @brief   Refuse to read a value of a type which isn't a number from text.
+ *  @details Such values can only be set from bytes, with @c put_bytes().
+ *  @returns False, always
+ */
+template <class DataType>
+bool share_parse_text (const char* p_text, DataType& value)
+{
+    (void)p_text;
+    (void)value;
+    return false;
+}
+
+#endif // _BASESHARE_H_
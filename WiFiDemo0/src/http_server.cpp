@@ -0,0 +1,750 @@
+/** @file http_server.cpp
+ *    This file contains source code for a small event-driven web server which
+ *    runs on BSD sockets, either on the ESP32's lwIP stack or on a PC.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include <PrintStream.h>
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <ctype.h>
+#include <stdarg.h>
+#ifdef ESP32
+    #include <lwip/sockets.h>
+#else
+    #include <sys/socket.h>
+    #include <sys/select.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+#endif
+#include "http_server.h"
+
+// On a PC, writing to a connection the browser has closed must not raise a
+// signal which kills the program; lwIP has no such signal
+#ifndef MSG_NOSIGNAL
+    #define MSG_NOSIGNAL 0
+#endif
+
+
+/** @brief   Get the words which go with an HTTP status code.
+ *  @param   code The status code, such as 404
+ *  @returns The words, such as "Not Found"
+ */
+static const char* status_text (int code)
+{
+    switch (code)
+    {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 403: return "Forbidden";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 406: return "Not Acceptable";
+        case 413: return "Payload Too Large";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default:  return "";
+    }
+}
+
+
+/** @brief   Add formatted text to the end of a buffer if there's room.
+ *  @param   buffer The buffer
+ *  @param   size The size of the buffer
+ *  @param   count The number of characters in the buffer, which is made
+ *           @c size or more if the text didn't fit
+ *  @param   format A format string as for @c printf()
+ */
+static void append (char* buffer, size_t size, size_t& count,
+                    const char* format, ...)
+{
+    if (count >= size)
+    {
+        return;
+    }
+    va_list args;
+    va_start (args, format);
+    count += vsnprintf (buffer + count, size - count, format, args);
+    va_end (args);
+}
+
+
+/** @brief   Create an unused connection slot.
+ */
+HttpRequest::HttpRequest (void)
+    : socket (-1), start_us (0), last_used_ms (0)
+{
+    reset ();
+}
+
+
+/** @brief   Get ready for the next request on the same connection.
+ *  @details Anything in the buffer is thrown away, so bytes which belong to
+ *           the next request must be moved to the front of the buffer and
+ *           @c received set again afterwards.
+ */
+void HttpRequest::reset (void)
+{
+    received = 0;
+    header_length = 0;
+    content_length = 0;
+    p_method = "";
+    p_path = "";
+    p_query = "";
+    http_1_1 = false;
+    keep_alive = false;
+    detached = false;
+    buffer[0] = '\0';
+}
+
+
+/** @brief   Split up the request line and find the length of the body.
+ *  @details The request line, such as "GET /live?ms=500 HTTP/1.1", has '\0'
+ *           characters put in it so that its parts can be used as strings.
+ *           This is called once all the headers have arrived.
+ *  @returns True if the request line and length made sense, false if not
+ */
+bool HttpRequest::parse (void)
+{
+    char* p_line_end = strstr (buffer, "\r\n");
+    *p_line_end = '\0';
+
+    char* p_space = strchr (buffer, ' ');
+    if (p_space == NULL)
+    {
+        return false;
+    }
+    *p_space = '\0';
+    p_method = buffer;
+    p_path = p_space + 1;
+
+    p_space = strchr (p_space + 1, ' ');
+    if (p_space == NULL)
+    {
+        return false;
+    }
+    *p_space = '\0';
+    http_1_1 = (strcmp (p_space + 1, "HTTP/1.1") == 0);
+
+    char* p_question = strchr ((char*)p_path, '?');
+    if (p_question != NULL)
+    {
+        *p_question = '\0';
+        p_query = p_question + 1;
+    }
+
+    // HTTP/1.1 connections stay open unless the browser says not to, and
+    // HTTP/1.0 connections close unless it asks for them to stay open
+    char value[16];
+    keep_alive = http_1_1;
+    if (get_header ("Connection", value, sizeof (value)))
+    {
+        if (strcasecmp (value, "close") == 0)
+        {
+            keep_alive = false;
+        }
+        else if (strcasecmp (value, "keep-alive") == 0)
+        {
+            keep_alive = true;
+        }
+    }
+
+    // The length must be all digits, with nothing after it but spaces; one
+    // too big for strtoul(), or long enough to have been cut off when it was
+    // copied, is refused rather than taken as some other length
+    content_length = 0;
+    char number[24];
+    if (get_header ("Content-Length", number, sizeof (number)))
+    {
+        char* p_end;
+        errno = 0;
+        unsigned long length = strtoul (number, &p_end, 10);
+        while (*p_end == ' ' || *p_end == '\t')
+        {
+            p_end++;
+        }
+        if (!isdigit ((unsigned char)number[0]) || *p_end != '\0'
+            || errno == ERANGE || length == ULONG_MAX
+            || strlen (number) >= sizeof (number) - 1)
+        {
+            return false;
+        }
+        content_length = length;
+    }
+    return true;
+}
+
+
+/** @brief   Copy a value from the query, such as "500" from "?ms=500".
+ *  @details Values aren't URL-decoded, so they should be plain words or
+ *           numbers.
+ *  @param   name The name of the value, such as "ms"
+ *  @param   value A buffer into which the value is copied, with a '\0'
+ *  @param   size The size of the buffer; longer values are cut off
+ *  @returns True if the value was in the query, false if not
+ */
+bool HttpRequest::get_arg (const char* name, char* value, size_t size)
+{
+    size_t name_length = strlen (name);
+    const char* p_arg = p_query;
+    while (*p_arg)
+    {
+        const char* p_end = strchr (p_arg, '&');
+        if (p_end == NULL)
+        {
+            p_end = p_arg + strlen (p_arg);
+        }
+        if (strncmp (p_arg, name, name_length) == 0
+            && (p_arg[name_length] == '=' || p_arg + name_length == p_end))
+        {
+            const char* p_value = p_arg + name_length;
+            if (*p_value == '=')
+            {
+                p_value++;
+            }
+            size_t length = p_end - p_value;
+            length = (length < size - 1) ? length : size - 1;
+            memcpy (value, p_value, length);
+            value[length] = '\0';
+            return true;
+        }
+        p_arg = *p_end ? p_end + 1 : p_end;
+    }
+    return false;
+}
+
+
+/** @brief   Copy the value of a request header.
+ *  @param   name The header's name, such as "Content-Length"; capital and
+ *           small letters are treated the same
+ *  @param   value A buffer into which the value is copied, with a '\0'
+ *  @param   size The size of the buffer; longer values are cut off
+ *  @returns True if the request had the header, false if not
+ */
+bool HttpRequest::get_header (const char* name, char* value, size_t size)
+{
+    size_t name_length = strlen (name);
+    const char* p_end = buffer + header_length;
+
+    // Headers start after the request line, which may have '\0's in it now
+    const char* p_line = (const char*)memchr (buffer, '\n', header_length);
+    while (p_line != NULL && ++p_line < p_end)
+    {
+        if (strncasecmp (p_line, name, name_length) == 0
+            && p_line[name_length] == ':')
+        {
+            const char* p_value = p_line + name_length + 1;
+            while (*p_value == ' ')
+            {
+                p_value++;
+            }
+            size_t length = strcspn (p_value, "\r\n");
+            length = (length < size - 1) ? length : size - 1;
+            memcpy (value, p_value, length);
+            value[length] = '\0';
+            return true;
+        }
+        p_line = (const char*)memchr (p_line, '\n', p_end - p_line);
+    }
+    return false;
+}
+
+
+/** @brief   Send a status line and headers.
+ *  @details If the length isn't known, an HTTP/1.1 browser is told that the
+ *           content comes in chunks; an HTTP/1.0 browser is sent the content
+ *           as it is, and the connection is closed to show where it ends.
+ *  @param   code The HTTP status code, such as 200
+ *  @param   content_type The MIME type of the content, such as "text/html",
+ *           or @c NULL if there's no content
+ *  @param   length The length of the content, or @c HTTP_CHUNKED ; it's
+ *           ignored for 204 and 304 responses, which have no content
+ *  @param   extra_headers More header lines, each ending in "\r\n", or
+ *           @c NULL if there aren't any
+ *  @returns True if the headers were sent, false if not
+ */
+bool HttpRequest::send_headers (int code, const char* content_type,
+                                long length, const char* extra_headers)
+{
+    if (length < 0 && !http_1_1)
+    {
+        keep_alive = false;
+    }
+
+    char headers[256];
+    size_t count = 0;
+    append (headers, sizeof (headers), count, "HTTP/1.%c %d %s\r\n",
+            http_1_1 ? '1' : '0', code, status_text (code));
+    if (content_type != NULL)
+    {
+        append (headers, sizeof (headers), count, "Content-Type: %s\r\n",
+                content_type);
+    }
+    if (code == 204 || code == 304)
+    {
+        // These responses never have content, so they don't say how long it is
+    }
+    else if (length >= 0)
+    {
+        append (headers, sizeof (headers), count, "Content-Length: %ld\r\n",
+                length);
+    }
+    else if (http_1_1)
+    {
+        append (headers, sizeof (headers), count,
+                "Transfer-Encoding: chunked\r\n");
+    }
+    append (headers, sizeof (headers), count, "Connection: %s\r\n%s\r\n",
+            keep_alive ? "keep-alive" : "close",
+            extra_headers != NULL ? extra_headers : "");
+    if (count >= sizeof (headers))
+    {
+        return false;
+    }
+    return write (headers, count);
+}
+
+
+/** @brief   Send a complete response whose content is in memory.
+ *  @param   code The HTTP status code, such as 200
+ *  @param   content_type The MIME type of the content, such as "text/plain"
+ *  @param   content The content
+ *  @param   length The number of bytes of content
+ *  @returns True if the response was sent, false if not
+ */
+bool HttpRequest::send (int code, const char* content_type,
+                        const char* content, size_t length)
+{
+    return send_headers (code, content_type, length)
+           && write (content, length);
+}
+
+
+/** @brief   Send a complete response whose content is a string.
+ *  @param   code The HTTP status code, such as 404
+ *  @param   content_type The MIME type of the content, such as "text/plain"
+ *  @param   content The content, a string which ends with '\0'
+ *  @returns True if the response was sent, false if not
+ */
+bool HttpRequest::send (int code, const char* content_type,
+                        const char* content)
+{
+    return send (code, content_type, content, strlen (content));
+}
+
+
+/** @brief   Send bytes on the connection, waiting until all are sent.
+ *  @details If the browser doesn't take the bytes within
+ *           @c HTTP_SEND_TIMEOUT_MS, or has gone away, the connection is
+ *           closed once the handler returns.
+ *  @param   p_data Pointer to the bytes
+ *  @param   size The number of bytes
+ *  @returns True if all the bytes were sent, false if not
+ */
+bool HttpRequest::write (const void* p_data, size_t size)
+{
+    const char* p_next = (const char*)p_data;
+    while (size)
+    {
+        int sent = ::send (socket, p_next, size, MSG_NOSIGNAL);
+        if (sent <= 0)
+        {
+            keep_alive = false;
+            return false;
+        }
+        p_next += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+
+/** @brief   Create a web server which will listen on the given port.
+ *  @details Nothing is done with the network until @c begin() is called, so
+ *           the server can be made as a global object.
+ *  @param   port The TCP port, usually 80
+ */
+HttpServer::HttpServer (uint16_t port)
+    : port (port), listener (-1), num_routes (0), p_not_found (NULL),
+      accepted (0), refused (0), requests (0), max_open (0),
+      latency_total_us (0), latency_max_us (0), status_time_ms (0)
+{
+}
+
+
+/** @brief   Handle requests for one page.
+ *  @param   path The page's path, such as "/live"
+ *  @param   handler The function which answers requests for the page
+ *  @returns True if the page was added, false if there are too many
+ */
+bool HttpServer::on (const char* path, HttpHandler handler)
+{
+    if (num_routes >= HTTP_MAX_ROUTES)
+    {
+        return false;
+    }
+    route_paths[num_routes] = path;
+    route_handlers[num_routes] = handler;
+    route_prefixes[num_routes] = false;
+    num_routes++;
+    return true;
+}
+
+
+/** @brief   Handle requests for every page whose path begins with a prefix.
+ *  @details Routes are checked in the order in which they were added, so a
+ *           page handled with @c on() should be added before a prefix which
+ *           covers it.
+ *  @param   prefix The beginning of the paths, such as "/shares/"
+ *  @param   handler The function which answers requests for the pages
+ *  @returns True if the prefix was added, false if there are too many routes
+ */
+bool HttpServer::on_prefix (const char* prefix, HttpHandler handler)
+{
+    if (!on (prefix, handler))
+    {
+        return false;
+    }
+    route_prefixes[num_routes - 1] = true;
+    return true;
+}
+
+
+/** @brief   Handle requests for pages which aren't otherwise handled.
+ *  @details If this isn't called, such requests get a plain 404 response.
+ *  @param   handler The function which answers the requests
+ */
+void HttpServer::on_not_found (HttpHandler handler)
+{
+    p_not_found = handler;
+}
+
+
+/** @brief   Start listening for connections.
+ *  @details This must be called after the network is up.
+ *  @returns True if the server is listening, false if the port couldn't be
+ *           opened
+ */
+bool HttpServer::begin (void)
+{
+    listener = ::socket (AF_INET, SOCK_STREAM, 0);
+    if (listener < 0)
+    {
+        return false;
+    }
+    int one = 1;
+    setsockopt (listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof (one));
+
+    struct sockaddr_in address;
+    memset (&address, 0, sizeof (address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl (INADDR_ANY);
+    address.sin_port = htons (port);
+    if (bind (listener, (struct sockaddr*)&address, sizeof (address)) < 0
+        || listen (listener, HTTP_MAX_CONNECTIONS) < 0)
+    {
+        close (listener);
+        listener = -1;
+        return false;
+    }
+    status_time_ms = millis ();
+    return true;
+}
+
+
+/** @brief   Wait until there's something to do, then do it.
+ *  @details The calling task is blocked in @c select() until a browser
+ *           connects or sends something, or until the timeout runs out.
+ *           Connections which have been idle for @c HTTP_IDLE_TIMEOUT_MS are
+ *           closed; the timeout should be short enough for this to be done
+ *           now and then, but there's no need for it to be shorter.
+ *  @param   timeout_ms The longest time to wait, in milliseconds
+ */
+void HttpServer::run_once (uint32_t timeout_ms)
+{
+    fd_set readable;
+    FD_ZERO (&readable);
+    FD_SET (listener, &readable);
+    int highest = listener;
+    for (uint8_t index = 0; index < HTTP_MAX_CONNECTIONS; index++)
+    {
+        int socket = connections[index].socket;
+        if (socket >= 0)
+        {
+            FD_SET (socket, &readable);
+            highest = (socket > highest) ? socket : highest;
+        }
+    }
+
+    struct timeval timeout;
+    timeout.tv_sec = timeout_ms / 1000;
+    timeout.tv_usec = (timeout_ms % 1000) * 1000;
+    if (select (highest + 1, &readable, NULL, NULL, &timeout) > 0)
+    {
+        // Connections which are open already are served first; then the
+        // new connection is taken, so its socket isn't checked by mistake
+        for (uint8_t index = 0; index < HTTP_MAX_CONNECTIONS; index++)
+        {
+            HttpRequest& connection = connections[index];
+            if (connection.socket >= 0
+                && FD_ISSET (connection.socket, &readable))
+            {
+                receive (connection);
+            }
+        }
+        if (FD_ISSET (listener, &readable))
+        {
+            accept_connection ();
+        }
+    }
+
+    uint32_t now = millis ();
+    for (uint8_t index = 0; index < HTTP_MAX_CONNECTIONS; index++)
+    {
+        HttpRequest& connection = connections[index];
+        if (connection.socket >= 0
+            && now - connection.last_used_ms > HTTP_IDLE_TIMEOUT_MS)
+        {
+            close_connection (connection);
+        }
+    }
+}
+
+
+/** @brief   Accept a new connection, or turn it away if the server is full.
+ *  @details Small responses are sent right away rather than held back to be
+ *           put in bigger packets, since the server already gathers its
+ *           output into chunks.
+ */
+void HttpServer::accept_connection (void)
+{
+    struct sockaddr_in address;
+    socklen_t address_size = sizeof (address);
+    int socket = accept (listener, (struct sockaddr*)&address,
+                         &address_size);
+    if (socket < 0)
+    {
+        return;
+    }
+    accepted++;
+
+    uint8_t open = 1;
+    HttpRequest* p_free = NULL;
+    for (uint8_t index = 0; index < HTTP_MAX_CONNECTIONS; index++)
+    {
+        if (connections[index].socket >= 0)
+        {
+            open++;
+        }
+        else if (p_free == NULL)
+        {
+            p_free = connections + index;
+        }
+    }
+    if (p_free == NULL)
+    {
+        static const char BUSY[] = "HTTP/1.1 503 Service Unavailable\r\n"
+                                   "Content-Length: 0\r\n"
+                                   "Connection: close\r\n\r\n";
+        ::send (socket, BUSY, sizeof (BUSY) - 1, MSG_DONTWAIT | MSG_NOSIGNAL);
+        close (socket);
+        refused++;
+        return;
+    }
+
+    int one = 1;
+    setsockopt (socket, IPPROTO_TCP, TCP_NODELAY, &one, sizeof (one));
+    struct timeval timeout;
+    timeout.tv_sec = HTTP_SEND_TIMEOUT_MS / 1000;
+    timeout.tv_usec = (HTTP_SEND_TIMEOUT_MS % 1000) * 1000;
+    setsockopt (socket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof (timeout));
+
+    p_free->reset ();
+    p_free->socket = socket;
+    p_free->last_used_ms = millis ();
+    max_open = (open > max_open) ? open : max_open;
+}
+
+
+/** @brief   Read what has arrived on a connection and answer whole requests.
+ *  @details A browser may send its next request before the last one has been
+ *           answered, so any bytes left after a request are kept for the
+ *           next one. The latency of a request is measured from when its
+ *           first bytes are read until its handler has sent the response.
+ *  @param   connection The connection which has something to read
+ */
+void HttpServer::receive (HttpRequest& connection)
+{
+    if (connection.received == 0)
+    {
+        connection.start_us = micros ();
+    }
+    int got = recv (connection.socket, connection.buffer + connection.received,
+                    HTTP_REQUEST_SIZE - connection.received, 0);
+    if (got <= 0)
+    {
+        close_connection (connection);      // The browser hung up
+        return;
+    }
+    connection.received += got;
+    connection.buffer[connection.received] = '\0';
+    connection.last_used_ms = millis ();
+
+    while (connection.received)
+    {
+        if (connection.header_length == 0)
+        {
+            char* p_blank = strstr (connection.buffer, "\r\n\r\n");
+            if (p_blank == NULL)
+            {
+                if (connection.received >= HTTP_REQUEST_SIZE)
+                {
+                    connection.send (431, "text/plain", "Headers too long");
+                    close_connection (connection);
+                }
+                return;                     // Wait for the rest of the headers
+            }
+            connection.header_length = p_blank + 4 - connection.buffer;
+            if (!connection.parse ())
+            {
+                connection.keep_alive = false;
+                connection.send (400, "text/plain", "Bad request");
+                close_connection (connection);
+                return;
+            }
+            // Compared this way so that a huge length can't wrap the sum
+            if (connection.content_length
+                > HTTP_REQUEST_SIZE - connection.header_length)
+            {
+                connection.keep_alive = false;
+                connection.send (413, "text/plain", "Request too long");
+                close_connection (connection);
+                return;
+            }
+        }
+
+        size_t end = connection.header_length + connection.content_length;
+        if (connection.received < end)
+        {
+            return;                         // Wait for the rest of the body
+        }
+
+        // The body is made a string for the handler for a moment
+        char saved = connection.buffer[end];
+        connection.buffer[end] = '\0';
+        dispatch (connection);
+        connection.buffer[end] = saved;
+
+        uint32_t latency_us = micros () - connection.start_us;
+        requests++;
+        latency_total_us += latency_us;
+        latency_max_us = (latency_us > latency_max_us) ? latency_us
+                                                       : latency_max_us;
+
+        if (connection.detached)
+        {
+            connection.reset ();            // Someone else owns the socket now
+            connection.socket = -1;
+            return;
+        }
+        if (!connection.keep_alive)
+        {
+            close_connection (connection);
+            return;
+        }
+
+        size_t left = connection.received - end;
+        connection.reset ();
+        memmove (connection.buffer, connection.buffer + end, left);
+        connection.received = left;
+        connection.buffer[left] = '\0';
+        connection.start_us = micros ();
+    }
+}
+
+
+/** @brief   Find the handler for a request and run it.
+ *  @param   connection The connection whose request is answered
+ */
+void HttpServer::dispatch (HttpRequest& connection)
+{
+    const char* p_path = connection.get_path ();
+    for (uint8_t index = 0; index < num_routes; index++)
+    {
+        if (route_prefixes[index]
+            ? strncmp (p_path, route_paths[index],
+                       strlen (route_paths[index])) == 0
+            : strcmp (p_path, route_paths[index]) == 0)
+        {
+            route_handlers[index] (connection);
+            return;
+        }
+    }
+    if (p_not_found != NULL)
+    {
+        p_not_found (connection);
+    }
+    else
+    {
+        connection.send (404, "text/plain", "Not found");
+    }
+}
+
+
+/** @brief   Close a connection and free its slot.
+ *  @param   connection The connection to be closed
+ */
+void HttpServer::close_connection (HttpRequest& connection)
+{
+    close (connection.socket);
+    connection.socket = -1;
+    connection.reset ();
+}
+
+
+/** @brief   Print connection counts, request rate, and latency.
+ *  @details The request rate and latencies are for the time since the status
+ *           was last printed, and are started over each time. The counts
+ *           aren't locked, so this must be called from the task which runs
+ *           the server, between calls to @c run_once().
+ *  @param   printer The device, such as @c Serial, on which to print
+ */
+void HttpServer::print_status (Print& printer)
+{
+    uint8_t open = 0;
+    for (uint8_t index = 0; index < HTTP_MAX_CONNECTIONS; index++)
+    {
+        if (connections[index].socket >= 0)
+        {
+            open++;
+        }
+    }
+    uint32_t now = millis ();
+    uint32_t elapsed_ms = now - status_time_ms;
+
+    printer << "HTTP: " << open << " open (most " << max_open << "), "
+            << accepted << " accepted, " << refused << " refused, ";
+    printer.print (elapsed_ms ? requests * 1000.0 / elapsed_ms : 0.0, 1);
+    printer << " requests/s, latency ";
+    if (requests)
+    {
+        printer << (uint32_t)(latency_total_us / requests) << " us average, "
+                << latency_max_us << " us most" << endl;
+    }
+    else
+    {
+        printer << "none" << endl;
+    }
+
+    requests = 0;
+    latency_total_us = 0;
+    latency_max_us = 0;
+    status_time_ms = now;
+}
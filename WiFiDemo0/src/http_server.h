@@ -0,0 +1,254 @@
+/** @file http_server.h
+ *    This file contains the headers for a small event-driven web server. One
+ *    task waits in @c select() until a browser connects or sends something,
+ *    so the task doesn't run at all while the server is idle, and a request
+ *    is answered as soon as it arrives rather than when a polling loop next
+ *    gets around to it. Several browsers may be connected at once, and
+ *    connections are kept open between requests when browsers ask for that.
+ *
+ *    Only BSD socket calls are used, so this server runs the same way on the
+ *    ESP32's lwIP stack and on a PC, where it can be load tested; see
+ *    @c host/host_server.cpp .
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _HTTP_SERVER_H_
+#define _HTTP_SERVER_H_
+
+#include <Arduino.h>
+
+
+/// Most browser connections which may be open at once
+const uint8_t HTTP_MAX_CONNECTIONS = 4;
+
+/// Size of the buffer which holds a request's headers and body
+const size_t HTTP_REQUEST_SIZE = 1024;
+
+/// Most pages, including prefixes, which the server can handle
+const uint8_t HTTP_MAX_ROUTES = 12;
+
+/// Time after which an idle connection is closed, in milliseconds
+const uint32_t HTTP_IDLE_TIMEOUT_MS = 5000;
+
+/// Time a send may wait for a slow browser before giving up, in milliseconds
+const uint32_t HTTP_SEND_TIMEOUT_MS = 2000;
+
+/// Length passed to @c HttpRequest::send_headers() for a chunked response
+const long HTTP_CHUNKED = -1;
+
+
+/** @brief   One browser's connection and the request which it has sent.
+ *  @details The request line is split up in place in the buffer; headers are
+ *           left as they arrived and are searched for when asked for.
+ *           Handlers answer with @c send(), or with a @c ResponseWriter for
+ *           pages whose length isn't known in advance.
+ */
+class HttpRequest
+{
+    friend class HttpServer;
+
+protected:
+    /// The connection's socket, or -1 if this slot isn't in use
+    int socket;
+
+    /// The request's headers and body, with room for a terminating '\0'
+    char buffer[HTTP_REQUEST_SIZE + 1];
+
+    /// Number of bytes received into the buffer
+    size_t received;
+
+    /// Length of the request line and headers, or 0 until all have arrived
+    size_t header_length;
+
+    /// Length of the body given in the @c Content-Length header
+    size_t content_length;
+
+    /// The method, such as "GET", in the buffer
+    const char* p_method;
+
+    /// The path, such as "/live", in the buffer
+    const char* p_path;
+
+    /// The query, the part of the URL after a '?', in the buffer
+    const char* p_query;
+
+    /// True if the browser speaks HTTP/1.1, which can take chunked responses
+    bool http_1_1;
+
+    /// True if the connection stays open after this request is answered
+    bool keep_alive;
+
+    /// True once a handler has taken over the connection
+    bool detached;
+
+    /// The time in microseconds at which this request began to arrive
+    uint32_t start_us;
+
+    /// The time in milliseconds at which the connection was last used
+    uint32_t last_used_ms;
+
+    // Split up the request line and find the length of the body
+    bool parse (void);
+
+    // Get ready for the next request on the same connection
+    void reset (void);
+
+public:
+    // Create an unused connection slot
+    HttpRequest (void);
+
+    /// Return the method, such as "GET" or "PUT"
+    const char* get_method (void) { return p_method; }
+
+    /// Return the path, such as "/live", without any query
+    const char* get_path (void) { return p_path; }
+
+    /// Return the request's body, which is followed by a '\0'
+    const char* get_body (void) { return buffer + header_length; }
+
+    /// Return the length of the request's body
+    size_t get_body_length (void) { return content_length; }
+
+    /// Return the connection's socket
+    int get_socket (void) { return socket; }
+
+    /// Return true if the browser can take a chunked response
+    bool is_http_1_1 (void) { return http_1_1; }
+
+    // Copy a value from the query, such as "500" from "?ms=500"
+    bool get_arg (const char* name, char* value, size_t size);
+
+    // Copy the value of a request header
+    bool get_header (const char* name, char* value, size_t size);
+
+    // Send a status line and headers
+    bool send_headers (int code, const char* content_type, long length,
+                       const char* extra_headers = NULL);
+
+    // Send a complete response whose content is in memory
+    bool send (int code, const char* content_type, const char* content,
+               size_t length);
+
+    // Send a complete response whose content is a string
+    bool send (int code, const char* content_type, const char* content);
+
+    // Send bytes on the connection, waiting until all are sent
+    bool write (const void* p_data, size_t size);
+
+    /** @brief   Take the connection away from the server.
+     *  @details After this is called, the server forgets the connection
+     *           without closing it; whoever took it must close it.
+     */
+    void detach (void) { detached = true; }
+};
+
+
+/// A function which answers requests for one page
+typedef void (*HttpHandler) (HttpRequest& request);
+
+
+/** @brief   An event-driven web server on BSD sockets.
+ *  @details A server is made as a global object, then given its pages and
+ *           started once the network is up; the task which runs it then
+ *           calls @c run_once() forever:
+ *           @code
+ *           HttpServer server (80);
+ *           ...
+ *           server.on ("/shares", handle_shares);
+ *           server.on_not_found (handle_NotFound);
+ *           server.begin ();
+ *           for (;;)
+ *           {
+ *               server.run_once (1000);
+ *           }
+ *           @endcode
+ *           Handlers run one at a time in the server's task, so a handler
+ *           which takes a long time holds up other browsers.
+ */
+class HttpServer
+{
+protected:
+    /// The TCP port on which the server listens
+    uint16_t port;
+
+    /// The socket which listens for new connections
+    int listener;
+
+    /// The browsers' connections
+    HttpRequest connections[HTTP_MAX_CONNECTIONS];
+
+    /// The paths, or path prefixes, of the pages which are handled
+    const char* route_paths[HTTP_MAX_ROUTES];
+
+    /// The functions which handle the pages
+    HttpHandler route_handlers[HTTP_MAX_ROUTES];
+
+    /// True for routes which handle every path beginning with their path
+    bool route_prefixes[HTTP_MAX_ROUTES];
+
+    /// Number of pages which are handled
+    uint8_t num_routes;
+
+    /// The function which answers requests for pages not in the list
+    HttpHandler p_not_found;
+
+    /// Number of connections accepted since the server started
+    uint32_t accepted;
+
+    /// Number of connections turned away because all slots were full
+    uint32_t refused;
+
+    /// Number of requests answered since the status was last printed
+    uint32_t requests;
+
+    /// Most connections open at once since the server started
+    uint8_t max_open;
+
+    /// Total of the latencies of the requests since the status was printed
+    uint64_t latency_total_us;
+
+    /// Longest latency since the status was last printed
+    uint32_t latency_max_us;
+
+    /// The time at which the status was last printed, in milliseconds
+    uint32_t status_time_ms;
+
+    // Accept a new connection, or turn it away if the server is full
+    void accept_connection (void);
+
+    // Read what has arrived on a connection and answer whole requests
+    void receive (HttpRequest& connection);
+
+    // Find the handler for a request and run it
+    void dispatch (HttpRequest& connection);
+
+    // Close a connection and free its slot
+    void close_connection (HttpRequest& connection);
+
+public:
+    // Create a web server which will listen on the given port
+    HttpServer (uint16_t port);
+
+    // Handle requests for one page
+    bool on (const char* path, HttpHandler handler);
+
+    // Handle requests for every page whose path begins with a prefix
+    bool on_prefix (const char* prefix, HttpHandler handler);
+
+    // Handle requests for pages which aren't otherwise handled
+    void on_not_found (HttpHandler handler);
+
+    // Start listening for connections
+    bool begin (void);
+
+    // Wait until there's something to do, then do it
+    void run_once (uint32_t timeout_ms);
+
+    // Print connection counts, request rate, and latency
+    void print_status (Print& printer);
+};
+
+#endif // _HTTP_SERVER_H_
@@ -10,11 +10,60 @@
 #include <Arduino.h>
 #include <PrintStream.h>
 #include "task_wifi.h"
+#include "shares.h"
+#include "telemetry.h"
+
+
+/// The temperature in degrees C; it's fake, made up by the weather task
+Share<float> temperature ("Temperature");
+
+/// The relative humidity in percent; it's fake too
+Share<uint8_t> humidity ("Humidity");
+
+/// How often the weather task makes up new weather, in milliseconds
+Share<uint16_t> weather_ms ("Weather_ms");
+
+/// The stream which sends live data to browsers, 10 times a second
+TelemetryStream telemetry (100);
+
+/// The telemetry stream's temperature value
+ShareChannel<float> temperature_channel ("Temperature", temperature);
+
+/// The telemetry stream's humidity value
+ShareChannel<uint8_t> humidity_channel ("Humidity", humidity);
+
+
+/** @brief   Task which makes up weather data for the web pages to show.
+ *  @details The temperature and humidity wander randomly so that there's
+ *           something to see on the live data page.
+ *  @param   p_params Pointer to parameters, which is not used
+ */
+void task_weather (void* p_params)
+{
+    (void)p_params;
+
+    float degrees = 22.0;
+    int16_t percent = 36;
+    TickType_t wake_time = xTaskGetTickCount ();
+    for (;;)
+    {
+        degrees += random (-10, 11) / 100.0;
+        degrees = constrain (degrees, 15.0, 30.0);
+        percent = constrain (percent + random (-1, 2), 20, 80);
+        temperature.put (degrees);
+        humidity.put (percent);
+        uint16_t period;
+        weather_ms.get (period);
+        vTaskDelayUntil (&wake_time, pdMS_TO_TICKS (constrain (period, 10,
+                                                               5000)));
+    }
+}
 
 
 /** @brief   Set up the ESP32 to do a simple web demonstration.
- *  @details This program runs only one task. The task runs a web server using
- *           the ESP32's WiFi interface. 
+ *  @details One task runs a web server using the ESP32's WiFi interface,
+ *           another makes up weather data, and a third streams that data to
+ *           browsers which are showing the live data page. 
  */
 void setup (void) 
 {
@@ -22,21 +71,34 @@ void setup (void)
     delay (1000);
     Serial << "ESP32 Wifi with Arduino" << endl;
 
+    temperature.put (22.0);
+    humidity.put (36);
+    weather_ms.put (50);
+    weather_ms.set_writable ();
+    telemetry.add (temperature_channel);
+    telemetry.add (humidity_channel);
+
     // Create a task to run the WiFi connection. This task needs a lot of stack
     // space to prevent it crashing
     xTaskCreate (task_WiFi,
                  "WiFi",
                  4500,
-                 NULL,
+                 &telemetry,
                  3,
                  NULL);
+
+    xTaskCreate (task_weather, "Weather", 2000, NULL, 2, NULL);
+    xTaskCreate (TelemetryStream::run, "Telemetry", 3000, &telemetry, 2, NULL);
 }
 
 
-/** @brief   The Arduino loop function, which is unused in this program.
+/** @brief   The Arduino loop function, which prints how the live data stream
+ *           is doing every ten seconds.
  */
 void loop (void)
 {
+    telemetry.print_status (Serial);
+    delay (10000);
 }
 
 
@@ -0,0 +1,161 @@
+/** @file response_writer.cpp
+ *    This file contains source code for a class which streams a web page to a
+ *    client in chunks from a fixed buffer.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include "response_writer.h"
+
+
+/** @brief   Create a response writer which answers the given request.
+ *  @details A response writer is meant to be made on the stack inside a
+ *           request handler and used for one response.
+ *  @param   request The request which is being answered
+ */
+ResponseWriter::ResponseWriter (HttpRequest& request)
+    : p_request (&request), buffer (chunk + RESPONSE_CHUNK_HEAD),
+      chunked (false), count (0), total (0)
+{
+}
+
+
+/** @brief   Send the response's headers, with no content length given.
+ *  @details Since the length of the content isn't known until it has all
+ *           been made, the browser is told that it comes in chunks. A
+ *           browser which only speaks HTTP/1.0 gets the content unchunked,
+ *           and the connection is closed at the end to mark its end.
+ *  @param   code The HTTP status code, such as 200
+ *  @param   content_type The MIME type of the content, such as "text/html"
+ *  @param   extra_headers More header lines, each ending in "\r\n", or
+ *           @c NULL if there aren't any
+ */
+void ResponseWriter::begin (int code, const char* content_type,
+                            const char* extra_headers)
+{
+    count = 0;
+    total = 0;
+    chunked = p_request->is_http_1_1 ();
+    p_request->send_headers (code, content_type, HTTP_CHUNKED, extra_headers);
+}
+
+
+/** @brief   Put one character into the response.
+ *  @param   character The character
+ *  @returns The number of characters written, which is always 1
+ */
+size_t ResponseWriter::write (uint8_t character)
+{
+    if (count >= RESPONSE_BUFFER_SIZE)
+    {
+        send_buffer ();
+    }
+    buffer[count++] = character;
+    return 1;
+}
+
+
+/** @brief   Put a block of characters into the response.
+ *  @details The block is copied into the buffer as many times as needed,
+ *           sending a chunk each time the buffer fills.
+ *  @param   p_data Pointer to the characters
+ *  @param   size The number of characters
+ *  @returns The number of characters written, which is always @c size
+ */
+size_t ResponseWriter::write (const uint8_t* p_data, size_t size)
+{
+    size_t left = size;
+    while (left)
+    {
+        if (count >= RESPONSE_BUFFER_SIZE)
+        {
+            send_buffer ();
+        }
+        size_t piece = RESPONSE_BUFFER_SIZE - count;
+        if (piece > left)
+        {
+            piece = left;
+        }
+        memcpy (buffer + count, p_data, piece);
+        count += piece;
+        p_data += piece;
+        left -= piece;
+    }
+    return size;
+}
+
+
+/** @brief   Put a string which is stored in flash into the response.
+ *  @details The string is copied into the buffer in pieces, so it is never
+ *           copied whole into RAM.
+ *  @param   p_text The string, which should be declared @c PROGMEM
+ */
+void ResponseWriter::put_P (PGM_P p_text)
+{
+    size_t left = strlen_P (p_text);
+    while (left)
+    {
+        if (count >= RESPONSE_BUFFER_SIZE)
+        {
+            send_buffer ();
+        }
+        size_t piece = RESPONSE_BUFFER_SIZE - count;
+        if (piece > left)
+        {
+            piece = left;
+        }
+        memcpy_P (buffer + count, p_text, piece);
+        count += piece;
+        p_text += piece;
+        left -= piece;
+    }
+}
+
+
+/** @brief   Send what's left in the buffer and the chunk which ends the
+ *           response.
+ *  @details This must be called once at the end of each response, or the
+ *           client will wait for more.
+ */
+void ResponseWriter::end (void)
+{
+    send_buffer ();
+    if (chunked)
+    {
+        p_request->write ("0\r\n\r\n", 5);
+    }
+}
+
+
+/** @brief   Send what's in the buffer to the client as one chunk.
+ *  @details The chunk's length is put in front of the text and "\r\n" after
+ *           it, so each chunk goes out in one send. An empty buffer isn't
+ *           sent, because an empty chunk would tell the client that the
+ *           response has ended.
+ */
+void ResponseWriter::send_buffer (void)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (chunked)
+    {
+        char head[RESPONSE_CHUNK_HEAD + 1];
+        int head_size = snprintf (head, sizeof (head), "%x\r\n",
+                                  (unsigned int)count);
+        char* p_start = buffer - head_size;
+        memcpy (p_start, head, head_size);
+        buffer[count] = '\r';
+        buffer[count + 1] = '\n';
+        p_request->write (p_start, head_size + count + 2);
+    }
+    else
+    {
+        p_request->write (buffer, count);
+    }
+    total += count;
+    count = 0;
+}
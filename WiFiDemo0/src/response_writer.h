@@ -0,0 +1,97 @@
+/** @file response_writer.h
+ *    This file contains the headers for a class which streams a web page to a
+ *    client in pieces instead of building the whole page in a @c String.
+ *    Constant parts of a page are copied straight from flash, and live values
+ *    are printed into a small fixed buffer; each time the buffer fills, it is
+ *    sent as one chunk of an HTTP response with chunked transfer encoding.
+ *    Making a page therefore uses no heap memory, and the memory used for
+ *    each request is just the buffer, whatever the size of the page.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _RESPONSE_WRITER_H_
+#define _RESPONSE_WRITER_H_
+
+#include <Arduino.h>
+#include "http_server.h"
+
+
+/// Size of the buffer in which a response is gathered into chunks. Bigger
+/// chunks mean fewer TCP packets; the buffer is on the stack of the task
+/// which handles requests, so it mustn't be made too big
+const size_t RESPONSE_BUFFER_SIZE = 256;
+
+/// Room kept before the buffer for a chunk's length in hex and "\r\n"
+const size_t RESPONSE_CHUNK_HEAD = 6;
+
+
+/** @brief   Class which streams an HTTP response in chunks from a buffer.
+ *  @details This class is a @c Print, so numbers and strings can be written
+ *           into a response with @c print() or the @c << operator, just as
+ *           they are written to @c Serial. A page handler looks like this:
+ *           @code
+ *           const char PAGE_TOP[] PROGMEM = "<html><body><p>Speed: ";
+ *           ...
+ *           ResponseWriter page (request);
+ *           page.begin (200, "text/html");
+ *           page.put_P (PAGE_TOP);
+ *           page << speed << "</p></body></html>";
+ *           page.end ();
+ *           @endcode
+ */
+class ResponseWriter : public Print
+{
+protected:
+    /// The request which is being answered
+    HttpRequest* p_request;
+
+    /// Buffer in which text is gathered until there's a chunk's worth, with
+    /// room for the chunk's length before it and "\r\n" after it
+    char chunk[RESPONSE_CHUNK_HEAD + RESPONSE_BUFFER_SIZE + 2];
+
+    /// The part of @c chunk in which text is gathered
+    char* const buffer;
+
+    /// True if the response is sent in chunks, false if it's sent as is
+    bool chunked;
+
+    /// Number of characters now in the buffer
+    size_t count;
+
+    /// Number of characters of content sent so far in this response
+    size_t total;
+
+    // Send what's in the buffer to the client as one chunk
+    void send_buffer (void);
+
+public:
+    // Create a response writer which answers the given request
+    ResponseWriter (HttpRequest& request);
+
+    // Send the response's headers, with no content length given
+    void begin (int code, const char* content_type,
+                const char* extra_headers = NULL);
+
+    // Put one character into the response
+    size_t write (uint8_t character);
+
+    // Put a block of characters into the response
+    size_t write (const uint8_t* p_data, size_t size);
+
+    // Put a string which is stored in flash into the response
+    void put_P (PGM_P p_text);
+
+    // Send what's left in the buffer and the chunk which ends the response
+    void end (void);
+
+    /// Let the other versions of @c write() in @c Print still be used
+    using Print::write;
+
+    /// Return the number of characters of content sent so far
+    size_t get_total (void) { return total; }
+};
+
+#endif // _RESPONSE_WRITER_H_
@@ -0,0 +1,290 @@
+/** @file share_api.cpp
+ *    This file contains source code for web pages which read and change the
+ *    program's shares and queues by name.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include "taskshare.h"
+#include "response_writer.h"
+#include "share_api.h"
+
+
+/// Flag in a binary list showing that an item is a queue
+const uint8_t SHARE_FLAG_QUEUE = 0x01;
+
+/// Flag in a binary list showing that an item is writable
+const uint8_t SHARE_FLAG_WRITABLE = 0x02;
+
+
+/** @brief   Make an empty snapshot.
+ */
+ShareSnapshot::ShareSnapshot (void)
+    : count (0), time_ms (0)
+{
+}
+
+
+/** @brief   Copy the values of one shared item, or of all of them.
+ *  @details The list of shared items is made first; then every value is
+ *           copied in one pass inside a critical section, which takes a few
+ *           microseconds. Items beyond @c SHARE_SNAPSHOT_MAX, or whose values
+ *           don't fit in the buffer, are left out.
+ *  @param   p_only The one item to copy, or @c NULL to copy all of them
+ */
+void ShareSnapshot::take (BaseShare* p_only)
+{
+    size_t used = 0;
+    count = 0;
+    for (BaseShare* p_item = (p_only != NULL) ? p_only
+                                              : BaseShare::get_newest ();
+         p_item != NULL && count < SHARE_SNAPSHOT_MAX;
+         p_item = (p_only != NULL) ? NULL : p_item->get_next ())
+    {
+        if (used + p_item->get_size () <= SHARE_SNAPSHOT_SIZE)
+        {
+            items[count] = p_item;
+            offsets[count] = used;
+            used += p_item->get_size ();
+            count++;
+        }
+    }
+
+    SHARE_ENTER_CRITICAL ();
+    for (uint8_t index = 0; index < count; index++)
+    {
+        items[index]->snapshot (data + offsets[index]);
+    }
+    SHARE_EXIT_CRITICAL ();
+    time_ms = millis ();
+}
+
+
+/** @brief   Print a string as JSON, with quotes and escapes.
+ *  @param   printer The device on which to print the string
+ *  @param   p_text The string
+ */
+static void print_json_string (Print& printer, const char* p_text)
+{
+    printer.print ('"');
+    for (; *p_text; p_text++)
+    {
+        if (*p_text == '"' || *p_text == '\\')
+        {
+            printer.print ('\\');
+        }
+        if ((uint8_t)*p_text >= ' ')
+        {
+            printer.print (*p_text);
+        }
+    }
+    printer.print ('"');
+}
+
+
+/** @brief   Print the values as a JSON list, or one JSON object if there's
+ *           one.
+ *  @details A list looks like this:
+ *           @code
+ *           {"time":1234,"shares":[{"name":"Humidity","kind":"share",
+ *           "writable":false,"value":36},...]}
+ *           @endcode
+ *           One item is printed as one of the objects in the list, with the
+ *           time put in it.
+ *  @param   printer The device on which to print the values
+ *  @param   as_list True to print a list, false to print only the first item
+ */
+void ShareSnapshot::print_json (Print& printer, bool as_list)
+{
+    printer.print ("{\"time\":");
+    printer.print ((unsigned long)time_ms);
+    printer.print (as_list ? ",\"shares\":[" : ",");
+    for (uint8_t index = 0; index < count && (as_list || index == 0); index++)
+    {
+        BaseShare* p_item = items[index];
+        printer.print (index ? ",{\"name\":" : (as_list ? "{\"name\":"
+                                                        : "\"name\":"));
+        print_json_string (printer, p_item->get_name ());
+        printer.print (",\"kind\":\"");
+        printer.print (p_item->get_kind ());
+        printer.print (p_item->is_writable () ? "\",\"writable\":true"
+                                              : "\",\"writable\":false");
+        printer.print (",\"value\":");
+        p_item->print_json (printer, data + offsets[index]);
+        printer.print (as_list ? "}" : "");
+    }
+    printer.print (as_list ? "]}" : "}");
+}
+
+
+/** @brief   Write the values in binary.
+ *  @details The format of a list is given in @c share_api.h ; one item is
+ *           sent as just its value.
+ *  @param   printer The device to which the values are written
+ *  @param   as_list True to write a list, false to write the first value
+ */
+void ShareSnapshot::print_binary (Print& printer, bool as_list)
+{
+    if (!as_list)
+    {
+        if (count)
+        {
+            printer.write (data + offsets[0], items[0]->get_size ());
+        }
+        return;
+    }
+
+    printer.write ((const uint8_t*)&time_ms, sizeof (time_ms));
+    printer.write (count);
+    for (uint8_t index = 0; index < count; index++)
+    {
+        BaseShare* p_item = items[index];
+        uint8_t name_length = strlen (p_item->get_name ());
+        uint8_t flags = (p_item->is_writable () ? SHARE_FLAG_WRITABLE : 0)
+                        | (strcmp (p_item->get_kind (), "queue") == 0
+                           ? SHARE_FLAG_QUEUE : 0);
+        printer.write (name_length);
+        printer.write ((const uint8_t*)p_item->get_name (), name_length);
+        printer.write (flags);
+        printer.write ((uint8_t)p_item->get_size ());
+        printer.write (data + offsets[index], p_item->get_size ());
+    }
+}
+
+
+/** @brief   Find a shared item by name.
+ *  @param   p_name The item's name, such as "Humidity"
+ *  @returns A pointer to the item, or @c NULL if there isn't one by that name
+ */
+BaseShare* find_share (const char* p_name)
+{
+    for (BaseShare* p_item = BaseShare::get_newest (); p_item != NULL;
+         p_item = p_item->get_next ())
+    {
+        if (strcmp (p_item->get_name (), p_name) == 0)
+        {
+            return p_item;
+        }
+    }
+    return NULL;
+}
+
+
+/** @brief   Copy a name from a URL, turning "%20" and such into characters.
+ *  @param   p_url The name as it is in the URL
+ *  @param   p_name A buffer for the name
+ *  @param   size The size of the buffer
+ */
+static void url_decode (const char* p_url, char* p_name, size_t size)
+{
+    size_t length = 0;
+    while (*p_url && length < size - 1)
+    {
+        if (p_url[0] == '%' && isxdigit (p_url[1]) && isxdigit (p_url[2]))
+        {
+            char hex[3] = { p_url[1], p_url[2], '\0' };
+            p_name[length++] = (char)strtol (hex, NULL, 16);
+            p_url += 3;
+        }
+        else
+        {
+            p_name[length++] = *p_url++;
+        }
+    }
+    p_name[length] = '\0';
+}
+
+
+/** @brief   Return true if a request asks for binary rather than JSON.
+ *  @param   request The request
+ *  @returns True for binary, false for JSON
+ */
+static bool wants_binary (HttpRequest& request)
+{
+    char text[48];
+    if (request.get_arg ("format", text, sizeof (text)))
+    {
+        return strcmp (text, "bin") == 0;
+    }
+    return request.get_header ("Accept", text, sizeof (text))
+           && strstr (text, "application/octet-stream") != NULL;
+}
+
+
+/** @brief   Answer requests for /shares and /shares/<name>.
+ *  @details A @c GET gets a snapshot and streams it out through a
+ *           @c ResponseWriter, so no response is ever built whole in memory.
+ *           A @c PUT takes a value as text, such as "22.5", or as binary if
+ *           its @c Content-Type is @c application/octet-stream , and answers
+ *           204 if the value was set, 403 if the item isn't writable, or 400
+ *           if the value didn't make sense.
+ *  @param   request The request which is being answered
+ */
+void handle_shares (HttpRequest& request)
+{
+    // The path is "/shares" for the list, or "/shares/<name>" for one item
+    const char* p_name_in_url = request.get_path () + strlen ("/shares");
+    if (*p_name_in_url == '/')
+    {
+        p_name_in_url++;
+    }
+    bool as_list = (*p_name_in_url == '\0');
+    BaseShare* p_item = NULL;
+    if (!as_list)
+    {
+        char name[16];
+        url_decode (p_name_in_url, name, sizeof (name));
+        p_item = find_share (name);
+        if (p_item == NULL)
+        {
+            request.send (404, "text/plain", "No such share");
+            return;
+        }
+    }
+
+    if (strcmp (request.get_method (), "GET") == 0)
+    {
+        ShareSnapshot snapshot;
+        snapshot.take (p_item);
+        bool binary = wants_binary (request);
+        ResponseWriter response (request);
+        response.begin (200, binary ? "application/octet-stream"
+                                    : "application/json");
+        if (binary)
+        {
+            snapshot.print_binary (response, as_list);
+        }
+        else
+        {
+            snapshot.print_json (response, as_list);
+        }
+        response.end ();
+    }
+    else if (strcmp (request.get_method (), "PUT") == 0 && !as_list)
+    {
+        char type[40] = "";
+        request.get_header ("Content-Type", type, sizeof (type));
+        bool done = (strcmp (type, "application/octet-stream") == 0)
+                    ? p_item->put_bytes (request.get_body (),
+                                         request.get_body_length ())
+                    : p_item->put_text (request.get_body ());
+        if (done)
+        {
+            request.send_headers (204, NULL, 0);
+        }
+        else if (!p_item->is_writable ())
+        {
+            request.send (403, "text/plain", "Share isn't writable");
+        }
+        else
+        {
+            request.send (400, "text/plain", "Bad value");
+        }
+    }
+    else
+    {
+        request.send_headers (405, "text/plain", 0, "Allow: GET, PUT\r\n");
+    }
+}
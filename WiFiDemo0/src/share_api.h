@@ -0,0 +1,86 @@
+/** @file share_api.h
+ *    This file contains the headers for web pages which let a browser or a
+ *    program on a PC read every share and queue in the program by name, and
+ *    change those which are marked writable:
+ *    - @c GET @c /shares lists every shared item with its value
+ *    - @c GET @c /shares/<name> gets one item's value
+ *    - @c PUT @c /shares/<name> sets the value of a writable item
+ *
+ *    Values are sent as compact JSON, or as binary if the query has
+ *    @c format=bin in it or the request's @c Accept header asks for
+ *    @c application/octet-stream . A binary list is made of:
+ *    - the time in milliseconds, 4 bytes
+ *    - the number of items, 1 byte
+ *    - for each item: the length of its name (1 byte), the name, flags
+ *      (1 byte; 1 if it's a queue, 2 if it's writable), the length of its
+ *      value (1 byte), and the value
+ *
+ *    A binary value is in the processor's own format, little-endian on the
+ *    ESP32. A queue's value is the number of items waiting in it.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _SHARE_API_H_
+#define _SHARE_API_H_
+
+#include <Arduino.h>
+#include "baseshare.h"
+#include "http_server.h"
+
+
+/// Most shared items which can be put in one snapshot
+const uint8_t SHARE_SNAPSHOT_MAX = 16;
+
+/// Size of the buffer which holds the values in a snapshot
+const size_t SHARE_SNAPSHOT_SIZE = 256;
+
+
+/** @brief   The values of some shared items, all copied at the same moment.
+ *  @details The values are copied within one critical section, so no task
+ *           can change any of them partway through, and a set of values
+ *           which belong together is never seen half old and half new. The
+ *           values are formatted afterwards, outside the critical section.
+ */
+class ShareSnapshot
+{
+protected:
+    /// The shared items whose values were copied
+    BaseShare* items[SHARE_SNAPSHOT_MAX];
+
+    /// Where in @c data each item's value is
+    uint16_t offsets[SHARE_SNAPSHOT_MAX];
+
+    /// Number of items whose values were copied
+    uint8_t count;
+
+    /// The copied values
+    uint8_t data[SHARE_SNAPSHOT_SIZE];
+
+    /// The time at which the values were copied, in milliseconds
+    uint32_t time_ms;
+
+public:
+    // Make an empty snapshot
+    ShareSnapshot (void);
+
+    // Copy the values of one shared item, or of all of them
+    void take (BaseShare* p_only = NULL);
+
+    // Print the values as a JSON list, or one JSON object if there's one
+    void print_json (Print& printer, bool as_list);
+
+    // Write the values in binary
+    void print_binary (Print& printer, bool as_list);
+};
+
+
+// Find a shared item by name
+BaseShare* find_share (const char* p_name);
+
+// Answer requests for /shares and /shares/<name>
+void handle_shares (HttpRequest& request);
+
+#endif // _SHARE_API_H_
@@ -0,0 +1,28 @@
+/** @file shares.h
+ *    This file contains extern declarations of the shares and queues which
+ *    are used by more than one file in this program. The shares themselves
+ *    are made in @c main_web.cpp.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _SHARES_H_
+#define _SHARES_H_
+
+#include "taskshare.h"
+#include "taskqueue.h"
+
+
+/// The temperature in degrees C; it's fake, made up by the weather task
+extern Share<float> temperature;
+
+/// The relative humidity in percent; it's fake too
+extern Share<uint8_t> humidity;
+
+/// How often the weather task makes up new weather, in milliseconds; it can
+/// be changed from a browser with a @c PUT to @c /shares/Weather_ms
+extern Share<uint16_t> weather_ms;
+
+#endif // _SHARES_H_
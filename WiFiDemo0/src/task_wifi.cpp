@@ -11,24 +11,26 @@
  */
 
 #include <WiFi.h>
-#include <WebServer.h>
 #include "task_wifi.h"
+#include "shares.h"
+#include "share_api.h"
+#include "web_assets.h"
 
 
-/// A pointer to the web server object
-WebServer* p_server = NULL;
+/// The web server, which will listen on TCP port 80
+HttpServer web_server (80);
+
+/// A pointer to the telemetry stream which sends live data to browsers
+TelemetryStream* p_telemetry = NULL;
 
 
 /** @brief   Task which controls the WiFi module to run a web server.
- *  @param   p_params Pointer to parameters, which is not used
+ *  @param   p_params Pointer to the @c TelemetryStream which sends live data
+ *           to browsers which ask for it
  */
 void task_WiFi (void* p_params)
 {
-    (void)p_params;
-
-    // Create a web server object which will listen on TCP port 80
-    WebServer server (80);
-    p_server = &server;
+    p_telemetry = (TelemetryStream*)p_params;
 
     // Enter the password for your WiFi network
     char essid_buf[36];
@@ -53,60 +55,78 @@ void task_WiFi (void* p_params)
     Serial << endl << "WiFi connected at IP " << WiFi.localIP () << endl;
 
     // Install callback functions to handle web requests
-    server.on ("/", handle_OnConnect);
-    server.onNotFound (handle_NotFound);
+    add_asset_routes (web_server);
+    web_server.on ("/events", handle_Events);
+    web_server.on ("/shares", handle_shares);
+    web_server.on_prefix ("/shares/", handle_shares);
+    web_server.on_not_found (handle_NotFound);
 
     // Get the web server up and running
-    server.begin ();
+    while (!web_server.begin ())
+    {
+        Serial << "Can't start HTTP server; trying again" << endl;
+        vTaskDelay (1000);
+    }
     Serial << "HTTP server started." << endl;
 
-    // This has been moved from loop(), where it lived in example code
+    // This task sleeps in the web server until a browser connects or sends a
+    // request, so requests are answered at once and an idle server costs
+    // nothing. It wakes each second to close idle connections, and prints
+    // the server's status every ten seconds; the server's counts are only
+    // touched by this task, so they need no locking
+    uint32_t status_time = millis ();
     for (;;)
     {
-        server.handleClient ();
-        vTaskDelay (100);
+        web_server.run_once (1000);
+        if (millis () - status_time >= 10000)
+        {
+            status_time = millis ();
+            web_server.print_status (Serial);
+        }
     }
 }
 
 
-/** @brief   Function which runs when the web server makes a connection.
- */
-void handle_OnConnect (void)
-{
-    Serial << "Connected." << endl;
-    p_server->send (200, "text/html", SendHTML ()); 
-    // (*p_server).send (200, "text/html", SendHTML ());  // Exact same effect as line above
-}
-
-
 /** @brief   Function which sends a message when a given page on the server is
  *           not available.
+ *  @param   request The request which is being answered
  */
-void handle_NotFound ()
+void handle_NotFound (HttpRequest& request)
 {
-    p_server->send (404, "text/plain", "Not found");
+    request.send (404, "text/plain", "Not found");
 }
 
 
-/** @brief   Function which puts the HTML code for the web page in a String.
+/** @brief   Function which gives a browser's connection to the telemetry
+ *           stream.
+ *  @details The browser may ask for data less often than the stream makes it
+ *           with a query such as @c /events?ms=500 ; a longer period than
+ *           @c TELEMETRY_MAX_PERIOD_MS is cut to that. Once the stream has the
+ *           connection, or has closed it because the headers couldn't be
+ *           sent, the web server lets go of it.
+ *  @param   request The request which is being answered
  */
-String SendHTML (void)
+void handle_Events (HttpRequest& request)
 {
-    String str = "<!DOCTYPE html> <html>\n<head><meta name=\"viewport\"";
-    str += " content=\"width=device-width, initial-scale=1.0, ";
-    str += "user-scalable=no\">\n<title>ESP32 Weather Report</title>\n";
-    str += "<style>html { font-family: Helvetica; display: inline-block; ";
-    str += "margin: 0px auto; text-align: center;}\nbody{margin-top: 50px;}";
-    str += " h1 {color: #444444;margin: 50px auto 30px;}\np {font-size: 24px;";
-    str += "color: #444484;margin-bottom: 10px;}\n</style>\n</head>\n<body>\n";
-    str += "<div id=\"webpage\">\n";
-    str += "<h1>ESP32 Fake Weather Report</h1>\n";
-
-    str += "<p>Temperature: 72.4°C</p>";
-    str += "<p>Humidity: 36%</p>";
-
-    str += "</div>\n</body>\n</html>\n";
-    return str;
+    char period_text[8] = "0";
+    request.get_arg ("ms", period_text, sizeof (period_text));
+    unsigned long period_ms = strtoul (period_text, NULL, 10);
+    if (period_ms > TELEMETRY_MAX_PERIOD_MS)
+    {
+        period_ms = TELEMETRY_MAX_PERIOD_MS;
+    }
+    switch (p_telemetry->attach (request.get_socket (), (uint16_t)period_ms))
+    {
+        case TELEMETRY_NO_ROOM:
+            request.send (503, "text/plain", "Too many live data clients");
+            break;
+        case TELEMETRY_NAMES_TOO_LONG:
+            request.send (500, "text/plain", "Too many live data channels");
+            break;
+        default:                            // The stream has the socket now
+            request.detach ();
+            break;
+    }
 }
 
 
@@ -5,19 +5,22 @@
 
 #include <Arduino.h>
 #include <PrintStream.h>
+#include "http_server.h"
+#include "telemetry.h"
+
+
+/// The web server, which runs in the WiFi task
+extern HttpServer web_server;
 
 
 // The task function calls the others
 void task_WiFi (void* p_params);
 
-// Handle connections from a web client by sending a web page
-void handle_OnConnect ();
+// Give a browser's connection to the telemetry stream
+void handle_Events (HttpRequest& request);
 
 // Handle HTTP requests which aren't for an existing page
-void handle_NotFound ();
-
-// Send the HTML of the web page; it's just a static test page
-String SendHTML (void);
+void handle_NotFound (HttpRequest& request);
 
 // Allow the user to type a string and store it in a character buffer
 void enterStringWithEcho (Stream& stream, char* buffer, uint8_t size);
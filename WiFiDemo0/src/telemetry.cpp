@@ -0,0 +1,321 @@
+/** @file telemetry.cpp
+ *    This file contains source code for a live telemetry stream which pushes
+ *    the values in shares and queues to web browsers using Server-Sent Events.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include <PrintStream.h>
+#include <unistd.h>
+#include <errno.h>
+#include <lwip/sockets.h>
+#include "telemetry.h"
+
+
+/// The HTTP response headers which start an event stream. Browsers are told
+/// to wait 2 seconds before reconnecting if the connection is lost
+const char TELEMETRY_HEADERS[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "\r\n"
+    "retry: 2000\n";
+
+
+/** @brief   Create a telemetry stream which makes a frame at the given period.
+ *  @param   period_ms How often a frame is made, in milliseconds
+ */
+TelemetryStream::TelemetryStream (uint16_t period_ms)
+    : num_channels (0), period_ms (period_ms), frames_sent (0),
+      clients_dropped (0)
+{
+    for (uint8_t index = 0; index < TELEMETRY_MAX_CLIENTS; index++)
+    {
+        sockets[index] = -1;
+        client_periods[index] = 0;
+        client_times[index] = 0;
+        unsent_sizes[index] = 0;
+    }
+    mutex = xSemaphoreCreateMutex ();
+}
+
+
+/** @brief   Add a value to the telemetry stream.
+ *  @details Channels should be added at startup, before any browser is
+ *           attached, as browsers are told the channels' names only once.
+ *  @param   channel The channel which gets the value
+ *  @returns True if the channel was added, false if there are too many
+ */
+bool TelemetryStream::add (TelemetryChannel& channel)
+{
+    if (num_channels >= TELEMETRY_MAX_CHANNELS)
+    {
+        return false;
+    }
+    channels[num_channels++] = &channel;
+    return true;
+}
+
+
+/** @brief   Send all of some bytes on a socket, waiting if need be.
+ *  @details The web server's sockets have a send timeout, so this gives up
+ *           if the browser doesn't take the bytes in time.
+ *  @param   socket The socket
+ *  @param   p_data The bytes to be sent
+ *  @param   size The number of bytes
+ *  @returns True if every byte was sent, false if not
+ */
+static bool send_all (int socket, const void* p_data, size_t size)
+{
+    const uint8_t* p_byte = (const uint8_t*)p_data;
+    while (size)
+    {
+        int sent = send (socket, p_byte, size, 0);
+        if (sent <= 0)
+        {
+            return false;
+        }
+        p_byte += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+
+/** @brief   Start sending telemetry on a browser's connection.
+ *  @details This is called by the web server's handler for the event stream
+ *           page. The headers of an endless response and an event giving the
+ *           channels' names are sent, and the stream keeps the connection.
+ *           If they can't all be sent, the connection is closed rather than
+ *           left with half a response on it. Unless the browser was refused,
+ *           the handler must detach the connection from the web server, as
+ *           the stream has it now and closes it when the browser goes away.
+ *  @param   socket The socket of the connection to the browser
+ *  @param   period_ms How often the browser wants a frame, in milliseconds;
+ *           it's never less than the stream's period
+ *  @returns @c TELEMETRY_ATTACHED if the browser was attached; or
+ *           @c TELEMETRY_NO_ROOM if there are already
+ *           @c TELEMETRY_MAX_CLIENTS browsers, or
+ *           @c TELEMETRY_NAMES_TOO_LONG if the names event doesn't fit in a
+ *           frame, in which cases nothing was sent; or
+ *           @c TELEMETRY_SEND_FAILED if the connection failed and was closed
+ */
+TelemetryAttach TelemetryStream::attach (int socket, uint16_t period_ms)
+{
+    if (period_ms < this->period_ms)
+    {
+        period_ms = this->period_ms;
+    }
+
+    FrameBuffer names;
+    names.print ("event: names\ndata: ");
+    for (uint8_t index = 0; index < num_channels; index++)
+    {
+        if (index)
+        {
+            names.print (',');
+        }
+        names.print (channels[index]->get_name ());
+    }
+    names.print ("\n\n");
+    if (names.is_full ())
+    {
+        return TELEMETRY_NAMES_TOO_LONG;    // A cut-off event would confuse
+    }
+
+    // The headers are sent while the mutex is held so that the stream's task
+    // can't send a frame on this connection before them
+    TelemetryAttach result = TELEMETRY_NO_ROOM;
+    xSemaphoreTake (mutex, portMAX_DELAY);
+    for (uint8_t index = 0; index < TELEMETRY_MAX_CLIENTS
+                            && result == TELEMETRY_NO_ROOM; index++)
+    {
+        if (client_periods[index] == 0)
+        {
+            if (!send_all (socket, TELEMETRY_HEADERS,
+                           sizeof (TELEMETRY_HEADERS) - 1)
+                || !send_all (socket, names.get_data (), names.get_size ()))
+            {
+                close (socket);
+                clients_dropped++;
+                result = TELEMETRY_SEND_FAILED;
+                break;
+            }
+            sockets[index] = socket;
+            client_periods[index] = period_ms;
+            client_times[index] = millis () - period_ms;
+            unsent_sizes[index] = 0;
+            result = TELEMETRY_ATTACHED;
+        }
+    }
+    xSemaphoreGive (mutex);
+    return result;
+}
+
+
+/** @brief   Make a frame holding the newest value from each channel.
+ *  @details A frame is one Server-Sent Event: "data: " followed by the time
+ *           in milliseconds and each channel's value, separated by commas,
+ *           and ending with a blank line.
+ */
+void TelemetryStream::make_frame (void)
+{
+    frame.clear ();
+    frame.print ("data: ");
+    frame.print (millis ());
+    for (uint8_t index = 0; index < num_channels; index++)
+    {
+        frame.print (',');
+        channels[index]->print_value (frame);
+    }
+    frame.print ("\n\n");
+}
+
+
+/** @brief   Send as much as will go of the part of a frame which a
+ *           browser's connection hasn't taken yet.
+ *  @details This is called with the mutex held. The browser is dropped if
+ *           its connection has failed.
+ *  @param   index The browser's slot
+ *  @returns True if the whole frame has now been sent, false if some of it
+ *           is still waiting or the browser was dropped
+ */
+bool TelemetryStream::send_unsent (uint8_t index)
+{
+    int sent = send (sockets[index], unsent[index], unsent_sizes[index],
+                     MSG_DONTWAIT);
+    if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+        drop (index);
+        return false;
+    }
+    if (sent > 0)
+    {
+        unsent_sizes[index] -= sent;
+        memmove (unsent[index], unsent[index] + sent, unsent_sizes[index]);
+    }
+    if (unsent_sizes[index])
+    {
+        return false;
+    }
+    frames_sent++;
+    return true;
+}
+
+
+/** @brief   Close a browser's connection and free its slot.
+ *  @details This is called with the mutex held.
+ *  @param   index The browser's slot
+ */
+void TelemetryStream::drop (uint8_t index)
+{
+    close (sockets[index]);
+    sockets[index] = -1;
+    client_periods[index] = 0;
+    unsent_sizes[index] = 0;
+    clients_dropped++;
+}
+
+
+/** @brief   Make a frame and send it to each browser whose turn it is.
+ *  @details A frame is sent without waiting. If the connection's buffer is
+ *           full because the network or the browser is slow, that browser
+ *           misses this frame and is sent the next one, so updates are
+ *           coalesced rather than piling up. If the connection takes only
+ *           part of a frame, the rest is kept and sent first each time until
+ *           it's all gone; no new frame goes to that browser until then, as
+ *           one frame started in the middle of another would garble both. A
+ *           browser which has gone away is dropped.
+ */
+void TelemetryStream::update (void)
+{
+    make_frame ();
+    if (frame.is_full ())
+    {
+        return;                             // A cut-off frame is useless
+    }
+
+    xSemaphoreTake (mutex, portMAX_DELAY);
+    uint32_t now = millis ();
+    for (uint8_t index = 0; index < TELEMETRY_MAX_CLIENTS; index++)
+    {
+        // Finish any frame which was only partly sent before starting one
+        if (client_periods[index] == 0
+            || (unsent_sizes[index] && !send_unsent (index)))
+        {
+            continue;
+        }
+
+        // Half a period of slack lets a browser which wants every frame get
+        // it even when the task runs a little early
+        if (now - client_times[index] + period_ms / 2 < client_periods[index])
+        {
+            continue;
+        }
+
+        int sent = send (sockets[index], frame.get_data (),
+                         frame.get_size (), MSG_DONTWAIT);
+        if (sent == (int)frame.get_size ())
+        {
+            client_times[index] = now;
+            frames_sent++;
+        }
+        else if (sent >= 0)
+        {
+            // Keep the rest of the frame to be sent next time
+            unsent_sizes[index] = frame.get_size () - sent;
+            memcpy (unsent[index], frame.get_data () + sent,
+                    unsent_sizes[index]);
+            client_times[index] = now;
+        }
+        else if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            // The connection is busy; try again with the next frame
+        }
+        else
+        {
+            drop (index);
+        }
+    }
+    xSemaphoreGive (mutex);
+}
+
+
+/** @brief   The RTOS task function which runs a telemetry stream.
+ *  @details A frame is made once each period, whether or not any browser
+ *           is attached, so that queues given to the stream are kept empty.
+ *  @param   p_params Pointer to the @c TelemetryStream which is run
+ */
+void TelemetryStream::run (void* p_params)
+{
+    TelemetryStream* p_stream = (TelemetryStream*)p_params;
+    TickType_t wake_time = xTaskGetTickCount ();
+    for (;;)
+    {
+        p_stream->update ();
+        vTaskDelayUntil (&wake_time, pdMS_TO_TICKS (p_stream->period_ms));
+    }
+}
+
+
+/** @brief   Print the number of browsers and frames sent.
+ *  @param   printer The device, such as @c Serial, on which to print
+ */
+void TelemetryStream::print_status (Print& printer)
+{
+    uint8_t attached = 0;
+    xSemaphoreTake (mutex, portMAX_DELAY);
+    for (uint8_t index = 0; index < TELEMETRY_MAX_CLIENTS; index++)
+    {
+        if (client_periods[index])
+        {
+            attached++;
+        }
+    }
+    xSemaphoreGive (mutex);
+    printer << "Telemetry: " << attached << " browsers, " << frames_sent
+            << " frames sent, " << clients_dropped << " dropped" << endl;
+}
@@ -0,0 +1,281 @@
+/** @file telemetry.h
+ *    This file contains the headers for a live telemetry stream which pushes
+ *    the values in shares and queues to web browsers using Server-Sent Events.
+ *    A browser opens one connection and keeps it open, and a compact text
+ *    frame holding the newest values is sent on it at a fixed rate, so there
+ *    is no HTTP request, headers, or new TCP connection for each update.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _TELEMETRY_H_
+#define _TELEMETRY_H_
+
+#include <Arduino.h>
+#include "taskshare.h"
+#include "taskqueue.h"
+
+
+/// Most browsers which can be sent telemetry at once
+const uint8_t TELEMETRY_MAX_CLIENTS = 4;
+
+/// Most values which can be in a telemetry stream
+const uint8_t TELEMETRY_MAX_CHANNELS = 8;
+
+/// Size of the buffer in which each frame of telemetry is made
+const size_t TELEMETRY_FRAME_SIZE = 128;
+
+/// Longest time between frames which a browser may ask for, in milliseconds
+const uint16_t TELEMETRY_MAX_PERIOD_MS = 60000;
+
+
+/// What became of a browser's connection given to @c TelemetryStream::attach()
+enum TelemetryAttach
+{
+    TELEMETRY_ATTACHED,             ///< The stream has the connection
+    TELEMETRY_NO_ROOM,              ///< Too many browsers; connection untouched
+    TELEMETRY_NAMES_TOO_LONG,       ///< Names don't fit; connection untouched
+    TELEMETRY_SEND_FAILED           ///< The stream closed the connection
+};
+
+
+/** @brief   A value which is sent in a telemetry stream.
+ *  @details Descendents of this class get a value from a share, queue, or
+ *           anything else, and print it as text.
+ */
+class TelemetryChannel
+{
+protected:
+    /// The name shown for this value in the browser
+    const char* name;
+
+public:
+    /** @brief   Create a telemetry channel.
+     *  @param   name The name shown for the value, which must last as long
+     *           as the channel does
+     */
+    TelemetryChannel (const char* name) : name (name) { }
+
+    /** @brief   Print the newest value.
+     *  @param   printer The device on which to print the value
+     */
+    virtual void print_value (Print& printer) = 0;
+
+    /// Return the name shown for this value in the browser
+    const char* get_name (void) { return name; }
+};
+
+
+/** @brief   A telemetry channel which sends the value in a share.
+ *  @details The share's data type must be one which @c Print can print.
+ */
+template <class DataType> class ShareChannel : public TelemetryChannel
+{
+protected:
+    /// The share whose value is sent
+    Share<DataType>* p_share;
+
+public:
+    /** @brief   Create a channel which sends the value in a share.
+     *  @param   name The name shown for the value
+     *  @param   share The share whose value is sent
+     */
+    ShareChannel (const char* name, Share<DataType>& share)
+        : TelemetryChannel (name), p_share (&share) { }
+
+    /** @brief   Print the value which is in the share now.
+     *  @param   printer The device on which to print the value
+     */
+    void print_value (Print& printer)
+    {
+        DataType value;
+        p_share->get (value);
+        printer.print (value);
+    }
+};
+
+
+/** @brief   A telemetry channel which sends the newest item in a queue.
+ *  @details Each time a frame is made, everything in the queue is taken out
+ *           and only the newest item is sent, so the queue can be filled
+ *           faster than telemetry is sent without filling up. This channel
+ *           must be the only reader of its queue. The queue's data type must
+ *           be one which @c Print can print.
+ */
+template <class DataType> class QueueChannel : public TelemetryChannel
+{
+protected:
+    /// The queue whose items are sent
+    Queue<DataType>* p_queue;
+
+    /// The newest item taken from the queue
+    DataType newest;
+
+public:
+    /** @brief   Create a channel which sends the newest item in a queue.
+     *  @param   name The name shown for the value
+     *  @param   queue The queue whose items are sent
+     */
+    QueueChannel (const char* name, Queue<DataType>& queue)
+        : TelemetryChannel (name), p_queue (&queue), newest () { }
+
+    /** @brief   Empty the queue and print the newest item which was in it.
+     *  @details If the queue is empty, the item sent last time is sent again.
+     *  @param   printer The device on which to print the value
+     */
+    void print_value (Print& printer)
+    {
+        while (p_queue->any ())
+        {
+            p_queue->get (newest);
+        }
+        printer.print (newest);
+    }
+};
+
+
+/** @brief   Class which makes a line of text in a fixed buffer.
+ *  @details This class is a @c Print, so values are printed into it just as
+ *           they would be to @c Serial. Text which doesn't fit is dropped.
+ */
+class FrameBuffer : public Print
+{
+protected:
+    /// The buffer in which the frame is made
+    char buffer[TELEMETRY_FRAME_SIZE];
+
+    /// Number of characters in the frame
+    size_t count;
+
+public:
+    /// Create an empty frame buffer
+    FrameBuffer (void) : count (0) { }
+
+    /** @brief   Put one character into the frame if there's room.
+     *  @param   character The character
+     *  @returns 1 if the character fit, 0 if not
+     */
+    size_t write (uint8_t character)
+    {
+        if (count >= TELEMETRY_FRAME_SIZE)
+        {
+            return 0;
+        }
+        buffer[count++] = character;
+        return 1;
+    }
+
+    /// Let the other versions of @c write() in @c Print still be used
+    using Print::write;
+
+    /// Empty the frame so that another can be made
+    void clear (void) { count = 0; }
+
+    /// Return a pointer to the characters in the frame
+    const uint8_t* get_data (void) { return (const uint8_t*)buffer; }
+
+    /// Return the number of characters in the frame
+    size_t get_size (void) { return count; }
+
+    /// Return true if the frame filled up and text was dropped
+    bool is_full (void) { return count >= TELEMETRY_FRAME_SIZE; }
+};
+
+
+/** @brief   A stream of telemetry sent to browsers with Server-Sent Events.
+ *  @details Channels are added at startup; then a web request handler gives
+ *           each browser which asks for the stream to @c attach(), and the
+ *           stream's task sends a frame to every attached browser each
+ *           period. Each frame is one line of text, the time in milliseconds
+ *           and then each channel's value, separated by commas. A browser
+ *           may ask for frames less often than the stream makes them; updates
+ *           are then coalesced, so it gets only the newest values when its
+ *           time comes, and nothing piles up for a slow browser. If a
+ *           browser's connection takes only part of a frame, the rest is
+ *           kept and sent before that browser's next frame, so events are
+ *           never cut apart. For example:
+ *           @code
+ *           TelemetryStream telemetry (100);
+ *           ShareChannel<float> temperature_channel ("Temperature", temperature);
+ *           ...
+ *           telemetry.add (temperature_channel);       // In setup()
+ *           xTaskCreate (TelemetryStream::run, "Telemetry", 3000, &telemetry,
+ *                        2, NULL);
+ *           @endcode
+ */
+class TelemetryStream
+{
+protected:
+    /// The values which are sent
+    TelemetryChannel* channels[TELEMETRY_MAX_CHANNELS];
+
+    /// Number of values which are sent
+    uint8_t num_channels;
+
+    /// Sockets of the connections to the browsers which are sent telemetry
+    int sockets[TELEMETRY_MAX_CLIENTS];
+
+    /// How often each browser wants a frame, in milliseconds; 0 if the
+    /// slot isn't in use
+    uint16_t client_periods[TELEMETRY_MAX_CLIENTS];
+
+    /// The time in milliseconds at which each browser was last sent a frame
+    uint32_t client_times[TELEMETRY_MAX_CLIENTS];
+
+    /// The part of a frame which each browser's connection hasn't taken yet
+    uint8_t unsent[TELEMETRY_MAX_CLIENTS][TELEMETRY_FRAME_SIZE];
+
+    /// Number of bytes in each browser's unsent part of a frame
+    size_t unsent_sizes[TELEMETRY_MAX_CLIENTS];
+
+    /// Mutex which keeps the web server and the stream's task from using
+    /// the list of browsers at the same time
+    SemaphoreHandle_t mutex;
+
+    /// How often a frame is made, in milliseconds
+    uint16_t period_ms;
+
+    /// The buffer in which each frame is made
+    FrameBuffer frame;
+
+    /// Number of frames sent to all browsers
+    uint32_t frames_sent;
+
+    /// Number of browsers dropped because their connections failed
+    uint32_t clients_dropped;
+
+    // Make a frame holding the newest value from each channel
+    void make_frame (void);
+
+    // Send as much as will go of the part of a frame a browser hasn't taken
+    bool send_unsent (uint8_t index);
+
+    // Close a browser's connection and free its slot
+    void drop (uint8_t index);
+
+public:
+    // Create a telemetry stream which makes a frame at the given period
+    TelemetryStream (uint16_t period_ms);
+
+    // Add a value to the telemetry stream
+    bool add (TelemetryChannel& channel);
+
+    // Start sending telemetry on a browser's connection
+    TelemetryAttach attach (int socket, uint16_t period_ms);
+
+    // Make a frame and send it to each browser whose turn it is
+    void update (void);
+
+    // The RTOS task function which runs a telemetry stream
+    static void run (void* p_params);
+
+    // Print the number of browsers and frames sent
+    void print_status (Print& printer);
+
+    /// Return how often a frame is made, in milliseconds
+    uint16_t get_period (void) { return period_ms; }
+};
+
+#endif // _TELEMETRY_H_
@@ -0,0 +1,149 @@
+/** @file web_assets.cpp
+ *    This file contains source code which sends the web server's static
+ *    pages from the compressed table in flash.
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+#include <Arduino.h>
+#include "web_assets.h"
+
+
+/** @brief   Find the file which is sent for a path.
+ *  @param   path The path, such as "/live", without any query
+ *  @returns A pointer to the file's entry in the table, or @c NULL if no
+ *           file has that path
+ */
+const WebAsset* find_asset (const char* path)
+{
+    for (uint8_t index = 0; index < WEB_ASSET_COUNT; index++)
+    {
+        if (strcmp (WEB_ASSETS[index].path, path) == 0)
+        {
+            return WEB_ASSETS + index;
+        }
+    }
+    return NULL;
+}
+
+
+/** @brief   Check whether a browser will take a gzipped file.
+ *  @details The @c Accept-Encoding header is a list such as
+ *           "gzip, deflate;q=0.5, *;q=0", in which a q-value of 0 means the
+ *           browser refuses that coding and "*" stands for each coding the
+ *           list doesn't name. Only whether a q-value is 0 matters here, so
+ *           it's checked for digits other than 0 rather than converted.
+ *  @param   p_list The value of the @c Accept-Encoding header
+ *  @returns True if gzip may be sent, false if not
+ */
+static bool accepts_gzip (const char* p_list)
+{
+    int8_t gzip = -1;                 // -1 if not named, else 0 or 1
+    int8_t others = -1;               // The same for "*"
+    while (*p_list)
+    {
+        p_list += strspn (p_list, " \t,");
+        const char* p_name = p_list;
+        size_t name_length = strcspn (p_list, " \t;,");
+        const char* p_end = p_list + strcspn (p_list, ",");
+
+        // Look through the coding's parameters for its q-value
+        int8_t wanted = 1;
+        for (const char* p_param = p_name + name_length; p_param < p_end; )
+        {
+            p_param += strspn (p_param, " \t;");
+            if ((*p_param == 'q' || *p_param == 'Q') && p_param[1] == '=')
+            {
+                const char* p_value = p_param + 2;
+                wanted = (strspn (p_value, "0.")
+                          != strcspn (p_value, " \t;,")) ? 1 : 0;
+            }
+            p_param += strcspn (p_param, ";,");
+        }
+
+        if ((name_length == 4 && strncasecmp (p_name, "gzip", 4) == 0)
+            || (name_length == 6 && strncasecmp (p_name, "x-gzip", 6) == 0))
+        {
+            gzip = wanted;
+        }
+        else if (name_length == 1 && *p_name == '*')
+        {
+            others = wanted;
+        }
+        p_list = p_end;
+    }
+    return (gzip >= 0) ? (gzip == 1) : (others == 1);
+}
+
+
+/** @brief   Have a web server send every file in the table.
+ *  @param   server The web server
+ *  @returns True if every file was added, false if the server ran out of
+ *           room for pages
+ */
+bool add_asset_routes (HttpServer& server)
+{
+    bool all_added = true;
+    for (uint8_t index = 0; index < WEB_ASSET_COUNT; index++)
+    {
+        all_added &= server.on (WEB_ASSETS[index].path, handle_asset);
+    }
+    return all_added;
+}
+
+
+/** @brief   Send the file asked for by a request.
+ *  @details If the browser's @c If-None-Match header holds the file's ETag,
+ *           it already has the file, and just a 304 response is sent. If not,
+ *           the compressed file is sent straight from flash with
+ *           @c Content-Encoding: @c gzip . The browser is asked to check
+ *           the ETag each time before using its copy, so a changed page is
+ *           seen at once. A browser which can't take gzip, or which gives it
+ *           a q-value of 0, is refused, as only the compressed file is kept;
+ *           every current browser takes it.
+ *  @param   request The request which is being answered
+ */
+void handle_asset (HttpRequest& request)
+{
+    const WebAsset* p_asset = find_asset (request.get_path ());
+    if (p_asset == NULL)
+    {
+        request.send (404, "text/plain", "Not found");
+        return;
+    }
+    bool head_only = (strcmp (request.get_method (), "HEAD") == 0);
+    if (!head_only && strcmp (request.get_method (), "GET") != 0)
+    {
+        request.send_headers (405, "text/plain", 0, "Allow: GET, HEAD\r\n");
+        return;
+    }
+
+    char headers[128];
+    snprintf (headers, sizeof (headers), "ETag: %s\r\nCache-Control: "
+              "no-cache\r\nVary: Accept-Encoding\r\n", p_asset->etag);
+
+    char text[64];
+    if (request.get_header ("If-None-Match", text, sizeof (text))
+        && (strstr (text, p_asset->etag) != NULL || strcmp (text, "*") == 0))
+    {
+        request.send_headers (304, NULL, 0, headers);
+        return;
+    }
+
+    if (!request.get_header ("Accept-Encoding", text, sizeof (text))
+        || !accepts_gzip (text))
+    {
+        request.send (406, "text/plain", "This page is only sent gzipped");
+        return;
+    }
+
+    strncat (headers, "Content-Encoding: gzip\r\n",
+             sizeof (headers) - strlen (headers) - 1);
+    if (request.send_headers (200, p_asset->content_type, p_asset->length,
+                              headers)
+        && !head_only)
+    {
+        request.write (p_asset->data, p_asset->length);
+    }
+}
@@ -0,0 +1,50 @@
+/** @file web_assets.h
+ *    This file contains the headers for the web server's static pages. The
+ *    pages are kept in the @c web directory; @c tools/make_web_assets.py
+ *    compresses them with gzip and puts them in a table in flash, in
+ *    @c web_assets_data.cpp . They're sent just as they are stored, so no
+ *    time is spent making or compressing them, and each page has an ETag
+ *    which lets a browser keep its copy until the page changes. Readings,
+ *    which do change, are fetched by the pages as JSON from @c /shares .
+ *
+ *  @author Matt Tagupa
+ *  @date  2026-Oct-18 Original file
+ */
+
+// This define prevents this .h file from being included more than once
+#ifndef _WEB_ASSETS_H_
+#define _WEB_ASSETS_H_
+
+#include <Arduino.h>
+#include "http_server.h"
+
+
+/** @brief   A file which the web server sends, compressed with gzip.
+ */
+struct WebAsset
+{
+    const char* path;                 ///< The path, such as "/live"
+    const char* content_type;         ///< The MIME type, such as "text/html"
+    const char* etag;                 ///< The ETag, with its quotes
+    const uint8_t* data;              ///< The compressed file, in flash
+    size_t length;                    ///< The number of compressed bytes
+};
+
+
+/// The table of files, made by @c tools/make_web_assets.py
+extern const WebAsset WEB_ASSETS[];
+
+/// The number of files in the table
+extern const uint8_t WEB_ASSET_COUNT;
+
+
+// Find the file which is sent for a path
+const WebAsset* find_asset (const char* path);
+
+// Have a web server send every file in the table
+bool add_asset_routes (HttpServer& server);
+
+// Send the file asked for by a request
+void handle_asset (HttpRequest& request);
+
+#endif // _WEB_ASSETS_H_
@@ -0,0 +1,160 @@
+/** @file web_assets_data.cpp
+ *    This file was made by @c tools/make_web_assets.py from the files
+ *    in the @c web directory. Don't edit it; edit those files and run
+ *    the script again.
+ */
+
+#include "web_assets.h"
+
+/// index.html, 652 bytes compressed from 1187
+static const uint8_t ASSET_INDEX_HTML[] PROGMEM =
+{
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x54,
+    0x6d, 0x6f, 0x9b, 0x30, 0x10, 0xfe, 0xce, 0xaf, 0xb8, 0x65, 0xda, 0x12,
+    0xa4, 0x00, 0x49, 0x5f, 0xa4, 0x29, 0x40, 0x26, 0xad, 0x4b, 0xd5, 0x4e,
+    0xd3, 0x5a, 0xad, 0x95, 0xa6, 0x7d, 0x74, 0xe0, 0x08, 0x5e, 0x8d, 0x8d,
+    0x6c, 0x43, 0x9b, 0x55, 0xf9, 0xef, 0x3b, 0x27, 0xd0, 0xb2, 0x45, 0xbb,
+    0x0f, 0x71, 0x78, 0xee, 0x9e, 0xe7, 0x5e, 0x7c, 0x90, 0xbc, 0xf9, 0x7c,
+    0x73, 0x71, 0xff, 0xf3, 0x76, 0x05, 0xa5, 0xad, 0xc4, 0xd2, 0x4b, 0xfa,
+    0x03, 0x59, 0x4e, 0x47, 0x85, 0x96, 0x81, 0x64, 0x15, 0xa6, 0xa3, 0x96,
+    0xe3, 0x63, 0xad, 0xb4, 0x1d, 0x41, 0xa6, 0xa4, 0x45, 0x69, 0xd3, 0xd1,
+    0x23, 0xcf, 0x6d, 0x99, 0xe6, 0xd8, 0xf2, 0x0c, 0x83, 0xfd, 0xc3, 0x14,
+    0xb8, 0xe4, 0x96, 0x33, 0x11, 0x98, 0x8c, 0x09, 0x4c, 0xe7, 0xe1, 0x6c,
+    0x0a, 0x8d, 0x41, 0xbd, 0x7f, 0x66, 0x6b, 0x82, 0xa4, 0x1a, 0x91, 0xb0,
+    0xe5, 0x56, 0xe0, 0x72, 0x75, 0x77, 0x7b, 0x7a, 0x02, 0x3f, 0x90, 0xd9,
+    0x12, 0x35, 0x7c, 0x47, 0xa7, 0x9f, 0x44, 0x07, 0x9f, 0x97, 0x18, 0xbb,
+    0x75, 0xa7, 0xab, 0x08, 0x9e, 0xa1, 0xa0, 0xac, 0x41, 0xc1, 0x2a, 0x2e,
+    0xb6, 0x0b, 0xb8, 0x42, 0xd1, 0xa2, 0xe5, 0x19, 0x8b, 0x21, 0xe7, 0xa6,
+    0x16, 0x8c, 0x30, 0x2e, 0x05, 0x97, 0x18, 0xac, 0x85, 0xca, 0x1e, 0x62,
+    0xa8, 0x98, 0xde, 0x70, 0xb9, 0x80, 0x59, 0xfd, 0x04, 0xac, 0xb1, 0x2a,
+    0x06, 0x8b, 0x4f, 0x36, 0x60, 0x82, 0x6f, 0x08, 0xcd, 0xa8, 0x7e, 0xd4,
+    0x31, 0xec, 0xbc, 0xb5, 0xca, 0xb7, 0xa4, 0x7e, 0x08, 0x0f, 0xac, 0xaa,
+    0x17, 0x70, 0x4e, 0x1c, 0xe7, 0x2a, 0xe7, 0xe4, 0xc8, 0x94, 0x50, 0x7a,
+    0x01, 0x6f, 0xcf, 0xf6, 0xf6, 0xaa, 0x7b, 0xde, 0x0b, 0xc3, 0x69, 0x17,
+    0x5e, 0xf7, 0x45, 0x1a, 0xfe, 0x1b, 0x17, 0x70, 0x72, 0xe6, 0xe0, 0x21,
+    0xfd, 0xc3, 0x0b, 0x3d, 0x58, 0x2b, 0x6b, 0x55, 0xb5, 0x80, 0x79, 0xc7,
+    0x4d, 0xa2, 0xae, 0xd9, 0x24, 0xea, 0x26, 0xef, 0xea, 0xa2, 0x23, 0xe7,
+    0x2d, 0xf0, 0x9c, 0x46, 0x8d, 0xeb, 0x9a, 0x6d, 0xd0, 0x8d, 0xae, 0x9c,
+    0x77, 0x73, 0xbb, 0x64, 0x0f, 0x78, 0x34, 0x3c, 0xf2, 0x7a, 0x49, 0xbd,
+    0xbc, 0xc7, 0xaa, 0x46, 0xcd, 0x6c, 0xa3, 0xa9, 0x94, 0xc4, 0xd4, 0x4c,
+    0xee, 0x65, 0x06, 0xf0, 0x68, 0x19, 0x04, 0x94, 0x96, 0x3c, 0xcb, 0xf7,
+    0x39, 0x6e, 0xe2, 0x8b, 0x24, 0xaa, 0xf7, 0xd4, 0xab, 0xa6, 0xe2, 0x39,
+    0xb7, 0xdb, 0x21, 0xaf, 0xc7, 0x06, 0xa4, 0x77, 0x7d, 0x7c, 0xc2, 0xa0,
+    0xd4, 0x58, 0xa4, 0xa3, 0x48, 0xf0, 0x96, 0x64, 0xbf, 0xd2, 0x2f, 0xe4,
+    0xcc, 0xb2, 0x24, 0x62, 0xcb, 0x43, 0x50, 0x44, 0x6d, 0xb8, 0x0b, 0xcd,
+    0x34, 0xaf, 0xed, 0xd2, 0x8b, 0x22, 0xb8, 0x2f, 0x11, 0x5c, 0x43, 0xc0,
+    0xad, 0x41, 0x51, 0x80, 0xc4, 0x96, 0x9a, 0xc8, 0x4a, 0x26, 0x37, 0x68,
+    0x62, 0x50, 0x52, 0x6c, 0x81, 0xfa, 0x02, 0x4d, 0xd3, 0xe0, 0x72, 0x63,
+    0x80, 0x69, 0x84, 0x02, 0x6d, 0x56, 0x62, 0x3e, 0x05, 0x66, 0xe0, 0xcb,
+    0xdd, 0xcd, 0x37, 0xaf, 0x68, 0x64, 0x66, 0xb9, 0x92, 0xd0, 0xd4, 0x94,
+    0x10, 0x61, 0xe2, 0xc3, 0xb3, 0x07, 0x64, 0xfb, 0x48, 0x98, 0x8c, 0x23,
+    0x53, 0x12, 0xd1, 0x8c, 0xfd, 0x90, 0xc4, 0x24, 0x4c, 0x5e, 0x08, 0x13,
+    0x4d, 0xa1, 0xa4, 0x4e, 0x93, 0x90, 0xa0, 0xc3, 0x5f, 0xc6, 0x61, 0x3e,
+    0x5d, 0x85, 0xbf, 0xe7, 0x3b, 0x3b, 0xa2, 0xb8, 0x9e, 0xfa, 0x04, 0xbd,
+    0x39, 0x2c, 0x3c, 0x24, 0x09, 0x0b, 0xa5, 0x57, 0xcc, 0xa5, 0x7d, 0xa5,
+    0x98, 0x7f, 0xe3, 0x9d, 0xb5, 0x4c, 0x03, 0x42, 0x0a, 0xb9, 0xca, 0x9a,
+    0x8a, 0x16, 0x31, 0xdc, 0xa0, 0x5d, 0x09, 0x74, 0x7f, 0x3f, 0x6d, 0xaf,
+    0x73, 0x62, 0x85, 0xee, 0x95, 0xf3, 0xe3, 0x23, 0x26, 0x2f, 0x60, 0x82,
+    0xae, 0x70, 0x0c, 0xdd, 0x36, 0x5f, 0x1c, 0x5e, 0x44, 0x92, 0xea, 0x28,
+    0x90, 0xa6, 0x30, 0x1e, 0xdc, 0xf1, 0xd8, 0x3f, 0x92, 0xf8, 0xaf, 0x7d,
+    0x04, 0x13, 0xb6, 0x4c, 0x34, 0x24, 0xad, 0x2e, 0xf9, 0x13, 0x52, 0x1d,
+    0x73, 0x1f, 0x16, 0x3d, 0xea, 0xb6, 0x74, 0x18, 0xbe, 0x1b, 0x94, 0xb7,
+    0xf3, 0xc3, 0x8c, 0xd9, 0xbf, 0x3b, 0xa7, 0x2a, 0x5d, 0xc8, 0xce, 0x7b,
+    0xb9, 0x9a, 0xd8, 0x33, 0x68, 0xaf, 0xdd, 0x7b, 0x47, 0x82, 0x30, 0x39,
+    0xe0, 0x53, 0x38, 0x99, 0xcd, 0x66, 0xe4, 0xa3, 0xad, 0xea, 0xb6, 0x23,
+    0x89, 0xba, 0xdd, 0x8f, 0x0e, 0xdf, 0xa2, 0x3f, 0x1a, 0x92, 0xae, 0xb8,
+    0xa3, 0x04, 0x00, 0x00,
+};
+
+/// live.html, 906 bytes compressed from 1748
+static const uint8_t ASSET_LIVE_HTML[] PROGMEM =
+{
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7d, 0x55,
+    0x51, 0x8f, 0xe2, 0x36, 0x10, 0x7e, 0xe7, 0x57, 0x4c, 0xb3, 0x3a, 0x85,
+    0xbd, 0x0d, 0x09, 0x1c, 0x3a, 0x54, 0x48, 0xa0, 0x6a, 0xef, 0x90, 0xee,
+    0xa4, 0xbd, 0xed, 0xaa, 0xbb, 0x2f, 0xd5, 0x8a, 0x07, 0xaf, 0x33, 0x10,
+    0xab, 0x8e, 0x9d, 0xc6, 0x26, 0x80, 0x4e, 0xfc, 0xf7, 0x8e, 0x9d, 0x40,
+    0x41, 0xb7, 0x2d, 0x42, 0x1a, 0x7b, 0x3c, 0xfe, 0x66, 0xe6, 0xf3, 0xcc,
+    0x24, 0xfb, 0xe9, 0xf3, 0xef, 0x9f, 0x9e, 0xff, 0x7c, 0x5c, 0x42, 0x61,
+    0x4b, 0xb9, 0xe8, 0x65, 0x27, 0x81, 0x2c, 0x27, 0x51, 0xa2, 0x65, 0xa0,
+    0x58, 0x89, 0xf3, 0xa0, 0x11, 0xb8, 0xab, 0x74, 0x6d, 0x03, 0xe0, 0x5a,
+    0x59, 0x54, 0x76, 0x1e, 0xec, 0x44, 0x6e, 0x8b, 0x79, 0x8e, 0x8d, 0xe0,
+    0x38, 0xf0, 0x9b, 0x08, 0x84, 0x12, 0x56, 0x30, 0x39, 0x30, 0x9c, 0x49,
+    0x9c, 0x8f, 0xe2, 0x61, 0x40, 0x30, 0x56, 0x58, 0x89, 0x8b, 0xe5, 0xd3,
+    0xe3, 0xf8, 0x03, 0xdc, 0x8b, 0x06, 0xe1, 0x33, 0xb3, 0x2c, 0x4b, 0x5a,
+    0x75, 0x2f, 0x33, 0xf6, 0xe0, 0xe4, 0xab, 0xce, 0x0f, 0xf0, 0x1d, 0xd6,
+    0x04, 0x3f, 0x58, 0xb3, 0x52, 0xc8, 0xc3, 0x0c, 0xbe, 0xa0, 0x6c, 0xd0,
+    0x0a, 0xce, 0x52, 0xb0, 0xb8, 0xb7, 0x03, 0x26, 0xc5, 0x46, 0xcd, 0x80,
+    0x93, 0x7f, 0xac, 0x53, 0x38, 0xf6, 0x38, 0x53, 0x0d, 0x33, 0x74, 0xcd,
+    0xfb, 0x9f, 0xc1, 0xf4, 0xe3, 0xbb, 0x14, 0x5e, 0x75, 0x9d, 0x63, 0x3d,
+    0x83, 0x51, 0xb5, 0x07, 0xa3, 0xa5, 0xc8, 0xe1, 0x86, 0x73, 0xee, 0xcc,
+    0xb3, 0xa4, 0x73, 0x96, 0x25, 0x5d, 0x8a, 0xce, 0xab, 0x4b, 0x78, 0xf4,
+    0x63, 0x7c, 0xa4, 0xeb, 0x65, 0x15, 0x88, 0x7c, 0x1e, 0x28, 0xbd, 0x0b,
+    0x16, 0x59, 0x52, 0x91, 0xa2, 0xf3, 0xe8, 0xb4, 0x95, 0xd4, 0xc4, 0x47,
+    0x4b, 0x43, 0x30, 0x19, 0x0e, 0x03, 0x28, 0x50, 0x6c, 0x0a, 0xa2, 0x66,
+    0x4c, 0x1b, 0xb2, 0x6f, 0x6d, 0x5d, 0x8a, 0xbc, 0x16, 0x95, 0x5d, 0xf4,
+    0x92, 0x04, 0x7e, 0x55, 0x07, 0xf8, 0x7b, 0x8b, 0xf5, 0x21, 0x02, 0xb3,
+    0xe5, 0x05, 0x10, 0x56, 0x22, 0xc9, 0xe9, 0x2f, 0xa5, 0x99, 0x7f, 0x1c,
+    0x0e, 0x89, 0x42, 0x03, 0x15, 0x33, 0x06, 0x73, 0xd0, 0x0a, 0xac, 0x06,
+    0x5b, 0x20, 0x60, 0x43, 0x19, 0x83, 0xb1, 0x35, 0xb2, 0xb2, 0xd7, 0xb0,
+    0xda, 0x3f, 0x8a, 0x81, 0x39, 0xbc, 0xac, 0x22, 0xa8, 0xf5, 0xee, 0xb4,
+    0x7c, 0x20, 0x49, 0xbe, 0xa3, 0x1e, 0xd0, 0x8f, 0x6b, 0xa9, 0x6b, 0x7f,
+    0x12, 0xde, 0xf0, 0xf1, 0x38, 0x8c, 0x20, 0xbc, 0x19, 0x4f, 0x78, 0x2b,
+    0xa7, 0xed, 0x9e, 0x77, 0x72, 0x3a, 0x9e, 0x76, 0xfa, 0x56, 0x4e, 0x26,
+    0x13, 0x2f, 0x87, 0xc3, 0x61, 0xb8, 0x4a, 0xbd, 0x4b, 0xde, 0x10, 0x54,
+    0xae, 0xf9, 0xb6, 0xa4, 0x58, 0xe2, 0x0d, 0xda, 0xa5, 0x44, 0xb7, 0xfc,
+    0xed, 0xf0, 0x35, 0x87, 0x7e, 0xe8, 0xc8, 0x08, 0x6f, 0x23, 0xe0, 0x7b,
+    0x32, 0xe3, 0x8d, 0x33, 0xf8, 0xe4, 0x2a, 0x65, 0x6f, 0xe9, 0xf0, 0x43,
+    0x1e, 0xde, 0xb6, 0x28, 0x3e, 0x6a, 0x85, 0x3b, 0x58, 0xba, 0x94, 0x9e,
+    0xf4, 0xb6, 0xe6, 0x48, 0x06, 0x89, 0xcf, 0xd0, 0x84, 0x70, 0x07, 0x52,
+    0x73, 0x66, 0x85, 0x56, 0xb1, 0x41, 0x56, 0xf3, 0x82, 0xee, 0xa1, 0x89,
+    0x59, 0x9e, 0xfb, 0x0b, 0xf7, 0xc2, 0x50, 0xf1, 0x61, 0x4d, 0x57, 0x3c,
+    0x05, 0x14, 0xe4, 0x7a, 0xab, 0xb8, 0xb3, 0x87, 0x3e, 0xde, 0xc2, 0x77,
+    0x9f, 0xf9, 0x89, 0x1d, 0x8c, 0x73, 0x7a, 0xc9, 0xd8, 0x54, 0x52, 0xb8,
+    0x28, 0x22, 0x17, 0x84, 0x3b, 0x3f, 0x33, 0x96, 0xf6, 0x8e, 0x2d, 0xbe,
+    0x56, 0x74, 0xc3, 0xb0, 0x0d, 0x92, 0xfa, 0x0d, 0x40, 0x17, 0x79, 0xf3,
+    0x26, 0x60, 0x5c, 0xb2, 0x0a, 0xfa, 0x0f, 0xdb, 0xf2, 0x15, 0xeb, 0x0e,
+    0xbd, 0x89, 0x4d, 0x21, 0xd6, 0x74, 0x7e, 0xe1, 0x2d, 0xae, 0xb6, 0xa6,
+    0x80, 0x7e, 0xd3, 0xa9, 0xc4, 0x1a, 0xfa, 0x5e, 0x2d, 0x51, 0x6d, 0x6c,
+    0x01, 0x0b, 0x78, 0x20, 0x57, 0xad, 0xe5, 0xf9, 0x32, 0xd5, 0xab, 0xb3,
+    0xcd, 0x6b, 0xb6, 0xf3, 0x58, 0xc7, 0xb4, 0x77, 0x0e, 0xad, 0x53, 0x5e,
+    0x84, 0x27, 0x35, 0xc5, 0x37, 0xc2, 0x69, 0x04, 0x85, 0xa0, 0xd5, 0xc0,
+    0x2f, 0x77, 0xed, 0x5b, 0x74, 0xcd, 0x59, 0xb4, 0xbb, 0xb6, 0x48, 0x23,
+    0xb0, 0xb4, 0x0d, 0xc3, 0x8b, 0x18, 0xd7, 0xba, 0x5e, 0x32, 0x2a, 0xc9,
+    0xfe, 0xbf, 0x0c, 0xd4, 0x27, 0x17, 0xde, 0xe8, 0x2d, 0x8b, 0xbd, 0x0b,
+    0xdc, 0x3b, 0xff, 0xc6, 0x6c, 0x11, 0x97, 0x82, 0x74, 0x52, 0x47, 0xb0,
+    0xa7, 0x04, 0x7c, 0x24, 0xad, 0x9a, 0xed, 0xa1, 0x5f, 0x88, 0x56, 0x7d,
+    0xec, 0x58, 0x38, 0x5e, 0xb0, 0x41, 0xa6, 0xd9, 0x9c, 0x70, 0x1c, 0x9a,
+    0xbf, 0x46, 0x90, 0x77, 0x30, 0x3a, 0x91, 0xc0, 0xf7, 0x31, 0x97, 0x54,
+    0x0f, 0x7f, 0x20, 0x27, 0x6e, 0xa8, 0x4b, 0xe8, 0xbf, 0xa3, 0x8c, 0x3a,
+    0x04, 0xff, 0xe0, 0x6f, 0x45, 0xa7, 0xa8, 0x20, 0x2f, 0x53, 0x20, 0x1c,
+    0xea, 0x22, 0xfd, 0x17, 0x3e, 0xb9, 0x39, 0xe0, 0xf8, 0xf0, 0x4d, 0xf2,
+    0xc2, 0xe1, 0x1d, 0xfc, 0xbc, 0x4a, 0x2f, 0xed, 0x5e, 0x71, 0x23, 0xd4,
+    0x23, 0x05, 0x7f, 0x7e, 0xc8, 0xff, 0x25, 0x8a, 0x1a, 0xf7, 0xd2, 0xd1,
+    0xe9, 0x59, 0x5c, 0x37, 0x08, 0x78, 0x4f, 0x2f, 0x91, 0x50, 0x99, 0xc0,
+    0x00, 0x46, 0xd4, 0x23, 0x07, 0x52, 0x16, 0xb4, 0xee, 0xd7, 0x2f, 0x7c,
+    0x45, 0xd2, 0xa5, 0xfd, 0x9e, 0x34, 0x89, 0xe7, 0xc1, 0xef, 0xd3, 0x2b,
+    0x24, 0xc7, 0x90, 0x83, 0x77, 0x71, 0x49, 0xa1, 0xf0, 0x59, 0x13, 0xf1,
+    0x84, 0xe3, 0xc8, 0x04, 0x94, 0x06, 0xdb, 0xa3, 0x52, 0x37, 0x57, 0x47,
+    0x67, 0x8c, 0xe3, 0x6d, 0xfa, 0x23, 0x05, 0x57, 0x79, 0x59, 0xb8, 0xa3,
+    0x6a, 0xc8, 0x4c, 0xc5, 0x14, 0xf8, 0x19, 0x39, 0x0f, 0x3c, 0x35, 0x33,
+    0xd7, 0x92, 0x57, 0x24, 0xd1, 0x3e, 0x0c, 0x16, 0x4e, 0xad, 0xdc, 0x72,
+    0x06, 0xe1, 0x55, 0xa8, 0xa4, 0x73, 0x1c, 0xbd, 0x5c, 0x96, 0x37, 0x65,
+    0xbd, 0x72, 0x99, 0x92, 0x39, 0x4d, 0x60, 0x72, 0xb1, 0x80, 0xf0, 0xba,
+    0x04, 0xfe, 0x7b, 0xae, 0xd0, 0xe8, 0xa5, 0x2e, 0x13, 0x8a, 0x9a, 0xfe,
+    0xcb, 0xf3, 0xb7, 0x7b, 0x62, 0xce, 0x52, 0x2b, 0xb8, 0x49, 0xde, 0xcd,
+    0xd4, 0x2c, 0xe9, 0x66, 0x78, 0xd2, 0x7e, 0xbc, 0xfe, 0x01, 0x6d, 0x69,
+    0xee, 0x71, 0xd4, 0x06, 0x00, 0x00,
+};
+
+/// The table of web pages and other files
+const WebAsset WEB_ASSETS[] =
+{
+    { "/", "text/html", "\"bd9c26f5a3bfb4df\"",
+      ASSET_INDEX_HTML, sizeof (ASSET_INDEX_HTML) },
+    { "/live", "text/html", "\"3f9d9898cd9fdfef\"",
+      ASSET_LIVE_HTML, sizeof (ASSET_LIVE_HTML) },
+};
+
+/// The number of files in the table
+const uint8_t WEB_ASSET_COUNT = 2;
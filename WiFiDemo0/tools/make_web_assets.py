@@ -0,0 +1,129 @@
+"""@file make_web_assets.py
+    This file compresses the web pages in the @c web directory and writes them
+    into @c src/web_assets_data.cpp as a table of constant arrays, which the
+    compiler puts in flash. The web server sends them as they are, already
+    compressed, with an ETag made from their contents, so a browser which has
+    a page already is told so with a tiny 304 response.
+
+    Run it from the @c WiFiDemo0 directory after changing anything in @c web:
+    @code
+    python3 tools/make_web_assets.py
+    @endcode
+    PlatformIO can also run it before each build by adding this to an
+    environment in @c platformio.ini :
+    @code
+    extra_scripts = pre:tools/make_web_assets.py
+    @endcode
+    The output file is only rewritten if it would change, so nothing is
+    recompiled when the pages haven't changed.
+
+    A page's path on the server is its file name, except that @c index.html
+    is @c / and other @c .html files lose the @c .html , so @c live.html is
+    @c /live .
+
+    @author Matt Tagupa
+    @date  2026-Oct-18 Original file
+"""
+
+import gzip
+import hashlib
+import os
+
+# The MIME type of each kind of file which can be served
+MIME_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+    ".txt": "text/plain",
+}
+
+
+def url_path(file_name):
+    """Return the path at which a file is served, such as "/live"."""
+    if file_name == "index.html":
+        return "/"
+    if file_name.endswith(".html"):
+        return "/" + file_name[:-len(".html")]
+    return "/" + file_name
+
+
+def c_name(file_name):
+    """Return a name for a file's array, such as "ASSET_LIVE_HTML"."""
+    return "ASSET_" + "".join(c if c.isalnum() else "_"
+                              for c in file_name.upper())
+
+
+def make_source(web_dir):
+    """Return the text of the C++ file which holds the compressed pages."""
+    lines = [
+        "/** @file web_assets_data.cpp",
+        " *    This file was made by @c tools/make_web_assets.py from the files",
+        " *    in the @c web directory. Don't edit it; edit those files and run",
+        " *    the script again.",
+        " */",
+        "",
+        "#include \"web_assets.h\"",
+        "",
+    ]
+    entries = []
+    for file_name in sorted(os.listdir(web_dir)):
+        extension = os.path.splitext(file_name)[1].lower()
+        if extension not in MIME_TYPES:
+            continue
+        with open(os.path.join(web_dir, file_name), "rb") as source:
+            raw = source.read()
+
+        # With no time or file name in it, the same page always compresses to
+        # the same bytes, so its ETag only changes when the page does
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = '\\"' + hashlib.sha256(packed).hexdigest()[:16] + '\\"'
+
+        name = c_name(file_name)
+        lines.append("/// %s, %d bytes compressed from %d"
+                     % (file_name, len(packed), len(raw)))
+        lines.append("static const uint8_t %s[] PROGMEM =" % name)
+        lines.append("{")
+        for start in range(0, len(packed), 12):
+            lines.append("    " + ", ".join("0x%02x" % byte for byte in
+                                            packed[start:start + 12]) + ",")
+        lines.append("};")
+        lines.append("")
+        entries.append('    { "%s", "%s", "%s",\n      %s, sizeof (%s) },'
+                       % (url_path(file_name), MIME_TYPES[extension], etag,
+                          name, name))
+
+    lines.append("/// The table of web pages and other files")
+    lines.append("const WebAsset WEB_ASSETS[] =")
+    lines.append("{")
+    lines.extend(entries)
+    lines.append("};")
+    lines.append("")
+    lines.append("/// The number of files in the table")
+    lines.append("const uint8_t WEB_ASSET_COUNT = %d;" % len(entries))
+    return "\n".join(lines) + "\n"
+
+
+def main(project_dir):
+    """Write @c src/web_assets_data.cpp if it's missing or out of date."""
+    text = make_source(os.path.join(project_dir, "web"))
+    output_path = os.path.join(project_dir, "src", "web_assets_data.cpp")
+    if os.path.exists(output_path):
+        with open(output_path) as old_file:
+            if old_file.read() == text:
+                return
+    with open(output_path, "w") as output_file:
+        output_file.write(text)
+    print("Wrote " + output_path)
+
+
+try:
+    # PlatformIO runs this file with SCons, which provides Import() and env
+    Import("env")
+    PROJECT_DIR = env.subst("$PROJECT_DIR")
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+main(PROJECT_DIR)